@@ -0,0 +1,107 @@
+#pragma once
+
+#include "vector.h"
+
+// Ограниченный MPSC-вектор поверх RawMemory: производители захватывают слоты
+// атомарным fetch-add в заранее зарезервированной ёмкости и конструируют
+// элементы на месте без блокировок; единственный потребитель читает
+// опубликованный префикс через begin()/end(). Реаллокация не поддерживается
+// под нагрузкой — Reserve допустим только в моменты, когда производители
+// остановлены (Reserve-first сценарий).
+template <typename T, typename Alloc = NewDeleteAllocator<T>>
+class ConcurrentVector {
+public:
+    explicit ConcurrentVector(size_t capacity, Alloc alloc = Alloc{})
+        : data_(capacity, std::move(alloc)) {
+    }
+
+    ConcurrentVector(const ConcurrentVector&) = delete;
+    ConcurrentVector& operator=(const ConcurrentVector&) = delete;
+
+    ~ConcurrentVector() {
+        std::destroy_n(data_.GetAddress(), committed_.load(std::memory_order_acquire));
+    }
+
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    // Потребительская сторона: виден только полностью опубликованный префикс
+    const_iterator begin() const noexcept {
+        return data_.GetAddress();
+    }
+
+    const_iterator end() const noexcept {
+        return data_.GetAddress() + Size();
+    }
+
+    size_t Size() const noexcept {
+        return committed_.load(std::memory_order_acquire);
+    }
+
+    size_t Capacity() const noexcept {
+        return data_.Capacity();
+    }
+
+    bool TryPushBack(const T& value) {
+        return TryEmplaceBack(value);
+    }
+
+    bool TryPushBack(T&& value) {
+        return TryEmplaceBack(std::move(value));
+    }
+
+    // Возвращает false при исчерпании ёмкости; слот публикуется строго
+    // после всех предшествующих, чтобы потребитель видел плотный префикс
+    template <typename... Args>
+    bool TryEmplaceBack(Args&&... args) {
+        // Исключение из конструктора после захвата слота навсегда заклинило бы
+        // цепочку публикации: следующие слоты ждут committed_ == slot
+        static_assert(std::is_nothrow_constructible_v<T, Args...>,
+                      "TryEmplaceBack requires nothrow construction");
+
+        const size_t slot = claimed_.fetch_add(1, std::memory_order_relaxed);
+        if (slot >= data_.Capacity()) {
+            claimed_.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        new (data_.GetAddress() + slot) T(std::forward<Args>(args)...);
+
+        size_t expected = slot;
+        while (!committed_.compare_exchange_weak(expected, slot + 1, std::memory_order_release,
+                                                 std::memory_order_relaxed)) {
+            expected = slot;
+        }
+        return true;
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        assert(index < Size());
+        return data_[index];
+    }
+
+    // Только при остановленных производителях
+    void Reserve(size_t capacity) {
+        if (capacity <= data_.Capacity()) return;
+
+        RawMemory<T, Alloc> newData(capacity, data_.GetAllocator());
+        const size_t count = committed_.load(std::memory_order_acquire);
+
+        RelocateN(data_.GetAddress(), count, newData.GetAddress());
+
+        DestroyRelocatedN(data_.GetAddress(), count);
+        data_.Swap(newData);
+    }
+
+    // Только при остановленных производителях
+    void Clear() noexcept {
+        std::destroy_n(data_.GetAddress(), committed_.load(std::memory_order_acquire));
+        committed_.store(0, std::memory_order_relaxed);
+        claimed_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    RawMemory<T, Alloc> data_;
+    std::atomic<size_t> claimed_{0};
+    std::atomic<size_t> committed_{0};
+};
@@ -0,0 +1,192 @@
+#pragma once
+
+#include "vector.h"
+
+#include <cstdint>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Вектор поверх mmap-файла: повторное открытие снапшота — это O(1)
+// отображение, страницы подгружаются лениво при первом обращении.
+// Reserve реализован как ftruncate + remap; Flush сбрасывает данные на диск.
+template <typename T>
+class FileVector {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "FileVector requires trivially copyable T");
+
+public:
+    explicit FileVector(const std::string& path) {
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd_ < 0) {
+            throw std::runtime_error("Failed to open " + path);
+        }
+
+        const off_t file_size = ::lseek(fd_, 0, SEEK_END);
+        if (file_size == 0) {
+            Remap(sizeof(Header));
+            *Hdr() = Header{kMagic, sizeof(T), 0, {}};
+        } else {
+            Remap(static_cast<size_t>(file_size));
+            if (Hdr()->magic != kMagic || Hdr()->element_size != sizeof(T)) {
+                ::munmap(mapped_, map_bytes_);
+                ::close(fd_);
+                throw std::runtime_error("Incompatible file format: " + path);
+            }
+        }
+    }
+
+    FileVector(const FileVector&) = delete;
+    FileVector& operator=(const FileVector&) = delete;
+
+    FileVector(FileVector&& other) noexcept
+        : fd_(other.fd_), mapped_(other.mapped_), map_bytes_(other.map_bytes_) {
+        other.fd_ = -1;
+        other.mapped_ = nullptr;
+        other.map_bytes_ = 0;
+    }
+
+    ~FileVector() {
+        if (mapped_ != nullptr) {
+            ::munmap(mapped_, map_bytes_);
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+    }
+
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    iterator begin() noexcept {
+        return Data();
+    }
+
+    iterator end() noexcept {
+        return Data() + Size();
+    }
+
+    const_iterator begin() const noexcept {
+        return Data();
+    }
+
+    const_iterator end() const noexcept {
+        return Data() + Size();
+    }
+
+    size_t Size() const noexcept {
+        return Hdr()->size;
+    }
+
+    size_t Capacity() const noexcept {
+        return (map_bytes_ - sizeof(Header)) / sizeof(T);
+    }
+
+    void Reserve(size_t capacity) {
+        if (capacity <= Capacity()) return;
+        Remap(sizeof(Header) + capacity * sizeof(T));
+    }
+
+    // Новые страницы файла по POSIX читаются нулями, так что расширение
+    // эквивалентно value-инициализации тривиальных T
+    void Resize(size_t new_size) {
+        if (new_size > Capacity()) {
+            Reserve(std::max(new_size, GrowthDoubling::Grow(Capacity(), new_size)));
+        }
+        Hdr()->size = new_size;
+    }
+
+    void PushBack(const T& value) {
+        if (Size() == Capacity()) {
+            Reserve(GrowthDoubling::Grow(Capacity(), Size() + 1));
+        }
+        Data()[Size()] = value;
+        ++Hdr()->size;
+    }
+
+    void Append(const T* data, size_t n) {
+        if (Size() + n > Capacity()) {
+            Reserve(GrowthDoubling::Grow(Capacity(), Size() + n));
+        }
+        std::memcpy(Data() + Size(), data, n * sizeof(T));
+        Hdr()->size += n;
+    }
+
+    void Flush() {
+        if (::msync(mapped_, map_bytes_, MS_SYNC) != 0) {
+            throw std::runtime_error("msync failed");
+        }
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return const_cast<FileVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept {
+        assert(index < Size());
+        return Data()[index];
+    }
+
+private:
+    // Заголовок дополнен до 64 байт, чтобы элементы начинались на максимально
+    // выровненном смещении (mmap выравнивает по странице); формат v2
+    struct Header {
+        uint64_t magic;
+        uint64_t element_size;
+        uint64_t size;
+        unsigned char reserved[40];
+    };
+    static_assert(sizeof(Header) == 64);
+    static_assert(alignof(T) <= 64,
+                  "FileVector supports alignment up to the 64-byte header");
+
+    static constexpr uint64_t kMagic = 0x41565653'4e415057ull;  // "AVVS/NAPW"
+
+    void Remap(size_t new_bytes) {
+        if (::ftruncate(fd_, static_cast<off_t>(new_bytes)) != 0) {
+            throw std::runtime_error("ftruncate failed");
+        }
+
+        void* mapped = nullptr;
+        if (mapped_ == nullptr) {
+            mapped = ::mmap(nullptr, new_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        } else {
+#if defined(__linux__)
+            mapped = ::mremap(mapped_, map_bytes_, new_bytes, MREMAP_MAYMOVE);
+#else
+            ::munmap(mapped_, map_bytes_);
+            mapped_ = nullptr;
+            mapped = ::mmap(nullptr, new_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+#endif
+        }
+        if (mapped == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+
+        mapped_ = mapped;
+        map_bytes_ = new_bytes;
+    }
+
+    Header* Hdr() noexcept {
+        return static_cast<Header*>(mapped_);
+    }
+
+    const Header* Hdr() const noexcept {
+        return static_cast<const Header*>(mapped_);
+    }
+
+    T* Data() noexcept {
+        return reinterpret_cast<T*>(static_cast<unsigned char*>(mapped_) + sizeof(Header));
+    }
+
+    const T* Data() const noexcept {
+        return const_cast<FileVector&>(*this).Data();
+    }
+
+private:
+    int fd_ = -1;
+    void* mapped_ = nullptr;
+    size_t map_bytes_ = 0;
+};
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "vector.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <string>
+
+// Сегментированный вектор для данных больше RAM: элементы лежат в сегментах
+// фиксированного размера, в памяти держится только горячее окно из hot_segments
+// сегментов, остальные вытесняются в backing-файл и подгружаются обратно по
+// обращению (pread/pwrite по смещению сегмента). Файл удаляется сразу после
+// открытия — это временное spill-хранилище, а не персистентность (см.
+// FileVector). Запись при вытеснении синхронная: последовательный pwrite
+// полного сегмента идёт со скоростью диска, и на append-only профиле
+// консолидации этого достаточно. Ссылка из operator[] действительна как
+// минимум до следующего обращения: последний затронутый сегмент закреплён и
+// не вытесняется, поэтому v[a] + v[b] безопасно. Более старые ссылки может
+// инвалидировать любое обращение, промахнувшееся мимо горячего окна.
+template <typename T, size_t SegmentElements = (size_t(1) << 16)>
+class HugeVector {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "HugeVector requires trivially copyable T");
+    static_assert(SegmentElements > 0, "Segment must hold at least one element");
+
+public:
+    // Окно клампится снизу двумя сегментами: один закреплён как последний
+    // использованный, и должен оставаться хотя бы один кандидат на вытеснение
+    explicit HugeVector(const std::string& path, size_t hot_segments = 4)
+        : hot_limit_(std::max<size_t>(2, hot_segments)) {
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd_ < 0) {
+            throw std::runtime_error("HugeVector: cannot open backing file");
+        }
+        ::unlink(path.c_str());
+    }
+
+    HugeVector(const HugeVector&) = delete;
+    HugeVector& operator=(const HugeVector&) = delete;
+
+    ~HugeVector() {
+        ::close(fd_);
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t SegmentCount() const noexcept {
+        return segments_.Size();
+    }
+
+    size_t ResidentSegments() const noexcept {
+        return hot_count_;
+    }
+
+    void PushBack(const T& value) {
+        const size_t seg = size_ / SegmentElements;
+        if (seg == segments_.Size()) {
+            EnsureHotBudget();
+            Segment fresh;
+            fresh.mem = RawMemory<T>(SegmentElements);
+            segments_.PushBack(std::move(fresh));
+            ++hot_count_;
+        } else {
+            EnsureResident(seg);
+        }
+        Touch(seg);
+        segments_[seg].mem[size_ % SegmentElements] = value;
+        ++size_;
+    }
+
+    T& operator[](size_t index) {
+        assert(index < size_);
+        const size_t seg = index / SegmentElements;
+        EnsureResident(seg);
+        Touch(seg);
+        return segments_[seg].mem[index % SegmentElements];
+    }
+
+    const T& operator[](size_t index) const {
+        return const_cast<HugeVector&>(*this)[index];
+    }
+
+    class Iterator {
+    public:
+        Iterator(HugeVector* owner, size_t index) noexcept
+            : owner_(owner), index_(index) {
+        }
+
+        T& operator*() const {
+            return (*owner_)[index_];
+        }
+
+        Iterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        bool operator==(const Iterator& rhs) const noexcept = default;
+
+    private:
+        HugeVector* owner_;
+        size_t index_;
+    };
+
+    Iterator begin() noexcept {
+        return Iterator(this, 0);
+    }
+
+    Iterator end() noexcept {
+        return Iterator(this, size_);
+    }
+
+private:
+    struct Segment {
+        RawMemory<T> mem;  // пустой, если сегмент вытеснен на диск
+        uint64_t last_use = 0;
+    };
+
+    bool IsResident(size_t seg) const noexcept {
+        return segments_[seg].mem.Capacity() != 0;
+    }
+
+    size_t ElementsInSegment(size_t seg) const noexcept {
+        const size_t from = seg * SegmentElements;
+        return std::min(SegmentElements, size_ - from);
+    }
+
+    void Touch(size_t seg) noexcept {
+        segments_[seg].last_use = ++clock_;
+    }
+
+    void EnsureResident(size_t seg) {
+        if (IsResident(seg)) {
+            return;
+        }
+        EnsureHotBudget();
+
+        RawMemory<T> mem(SegmentElements);
+        TransferBytes(seg, reinterpret_cast<char*>(mem.GetAddress()),
+                      ElementsInSegment(seg) * sizeof(T), /*write=*/false);
+        segments_[seg].mem = std::move(mem);
+        ++hot_count_;
+    }
+
+    // Вытесняет наиболее давно использованные сегменты, пока окно не влезет.
+    // Последний использованный сегмент закреплён и не вытесняется — иначе
+    // ссылка, только что выданная operator[], умирала бы на следующем же
+    // обращении
+    void EnsureHotBudget() {
+        size_t pinned = segments_.Size();
+        for (size_t i = 0; i < segments_.Size(); ++i) {
+            if (IsResident(i) && (pinned == segments_.Size()
+                                  || segments_[i].last_use > segments_[pinned].last_use)) {
+                pinned = i;
+            }
+        }
+
+        while (hot_count_ >= hot_limit_) {
+            size_t victim = segments_.Size();
+            for (size_t i = 0; i < segments_.Size(); ++i) {
+                if (i != pinned && IsResident(i)
+                    && (victim == segments_.Size()
+                        || segments_[i].last_use < segments_[victim].last_use)) {
+                    victim = i;
+                }
+            }
+            if (victim == segments_.Size()) {
+                return;
+            }
+            Spill(victim);
+        }
+    }
+
+    void Spill(size_t seg) {
+        TransferBytes(seg, reinterpret_cast<char*>(segments_[seg].mem.GetAddress()),
+                      ElementsInSegment(seg) * sizeof(T), /*write=*/true);
+        segments_[seg].mem = RawMemory<T>{};
+        --hot_count_;
+    }
+
+    void TransferBytes(size_t seg, char* buf, size_t count, bool write) const {
+        off_t offset = static_cast<off_t>(seg * SegmentElements * sizeof(T));
+        while (count != 0) {
+            const ssize_t done = write ? ::pwrite(fd_, buf, count, offset)
+                                       : ::pread(fd_, buf, count, offset);
+            if (done <= 0) {
+                throw std::runtime_error(write ? "HugeVector: spill write failed"
+                                               : "HugeVector: segment read failed");
+            }
+            buf += done;
+            offset += done;
+            count -= static_cast<size_t>(done);
+        }
+    }
+
+private:
+    Vector<Segment> segments_;
+    size_t size_ = 0;
+    size_t hot_limit_;
+    size_t hot_count_ = 0;
+    uint64_t clock_ = 0;
+    int fd_ = -1;
+};
@@ -1,6 +1,14 @@
 #include "vector.h"
+#include "small_vector.h"
+#include "file_vector.h"
+#include "huge_vector.h"
+#include "static_vector.h"
+#include "concurrent_vector.h"
+#include "soa_vector.h"
 
+#include <cstdio>
 #include <iostream>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 
@@ -98,8 +106,124 @@ struct Obj {
     static inline int num_destroyed = 0;
 };
 
+// Потокобезопасный счётчик живых объектов для параллельных сценариев
+struct ParObj {
+    ParObj() {
+        ++alive;
+    }
+    ParObj(const ParObj&) {
+        ++alive;
+    }
+    ParObj(ParObj&&) noexcept {
+        ++alive;
+    }
+    ParObj& operator=(const ParObj&) = default;
+    ParObj& operator=(ParObj&&) = default;
+    ~ParObj() {
+        --alive;
+    }
+
+    static inline std::atomic<int> alive{0};
+};
+
+struct AllocCounters {
+    int allocated = 0;
+    int deallocated = 0;
+};
+
+template <typename T>
+struct CountingAllocator {
+    AllocCounters* counters = nullptr;
+
+    T* Allocate(size_t n) {
+        if (n == 0) {
+            return nullptr;
+        }
+        ++counters->allocated;
+        return static_cast<T*>(operator new(n * sizeof(T)));
+    }
+
+    void Deallocate(T* buf, size_t /*n*/) noexcept {
+        if (buf != nullptr) {
+            ++counters->deallocated;
+        }
+        operator delete(buf);
+    }
+};
+
+// Тип с небезопасным (не-noexcept) перемещением: без трейта реаллокация
+// шла бы по пути глубокого копирования. Владеет только указателем в кучу,
+// поэтому побайтовый перенос для него корректен (в отличие от std::string
+// с его SSO-буфером, указывающим внутрь самого объекта)
+struct Reloc {
+    explicit Reloc(std::string name)
+        : name(std::make_unique<std::string>(std::move(name))) {
+    }
+
+    Reloc(const Reloc& other)
+        : name(std::make_unique<std::string>(*other.name)) {
+        ++num_copied;
+    }
+
+    Reloc(Reloc&& other)
+        : name(std::move(other.name)) {
+        ++num_moved;
+    }
+
+    Reloc& operator=(const Reloc&) = delete;
+    Reloc& operator=(Reloc&&) = default;
+
+    const std::string& Name() const noexcept {
+        return *name;
+    }
+
+    static void ResetCounters() {
+        num_copied = 0;
+        num_moved = 0;
+    }
+
+    std::unique_ptr<std::string> name;
+
+    static inline int num_copied = 0;
+    static inline int num_moved = 0;
+};
+
+// Тип без move-конструктора: RelocateN для него идёт по пути
+// uninitialized_copy_n, и копия может бросить посреди переноса
+struct CopyReloc {
+    explicit CopyReloc(int value)
+        : value(value) {
+        ++alive;
+    }
+
+    CopyReloc(const CopyReloc& other)
+        : value(other.value) {
+        if (copies_until_throw == 0) {
+            throw std::runtime_error("Oops");
+        }
+        if (copies_until_throw > 0) {
+            --copies_until_throw;
+        }
+        ++alive;
+    }
+
+    CopyReloc& operator=(const CopyReloc&) = default;
+
+    ~CopyReloc() {
+        --alive;
+    }
+
+    int value;
+
+    static inline int alive = 0;
+    static inline int copies_until_throw = -1;  // -1 — не бросать
+};
+
 }  // namespace
 
+template <>
+struct TriviallyRelocatable<Reloc> : std::true_type {};
+
 void Test1() {
     Obj::ResetCounters();
     const size_t SIZE = 100500;
@@ -380,6 +504,1229 @@ void Test5() {
     }
 }
 
+void Test6() {
+    const int ID = 42;
+    {
+        // Пока элементов не больше N, SmallVector обходится без кучи
+        SmallVector<int, 8> v;
+        assert(v.IsInline());
+        assert(v.Capacity() == 8);
+        for (int i = 0; i < 8; ++i) {
+            v.PushBack(i);
+        }
+        assert(v.IsInline());
+        assert(v.Size() == 8);
+
+        // Девятый элемент вытесняет содержимое в кучу
+        v.PushBack(8);
+        assert(!v.IsInline());
+        assert(v.Size() == 9);
+        for (int i = 0; i < 9; ++i) {
+            assert(v[i] == i);
+        }
+    }
+    {
+        Obj::ResetCounters();
+        SmallVector<Obj, 4> v;
+        v.EmplaceBack(ID);
+        v.EmplaceBack(ID + 1);
+        assert(v.IsInline());
+
+        SmallVector<Obj, 4> v_moved(std::move(v));
+        assert(v_moved.Size() == 2);
+        assert(v_moved[0].id == ID);
+        assert(v.Size() == 0);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        SmallVector<int, 2> a;
+        a.PushBack(1);
+        SmallVector<int, 2> b;
+        b.PushBack(2);
+        b.PushBack(3);
+        b.PushBack(4);
+        assert(!b.IsInline());
+        a.Swap(b);
+        assert(a.Size() == 3 && a[2] == 4);
+        assert(b.Size() == 1 && b[0] == 1);
+
+        const auto a_copy(a);
+        assert(a_copy.Size() == a.Size());
+        assert(&a_copy[0] != &a[0]);
+        assert(a_copy[1] == a[1]);
+    }
+}
+
+void Test7() {
+    AllocCounters counters;
+    {
+        Vector<int, CountingAllocator<int>> v(CountingAllocator<int>{&counters});
+        for (int i = 0; i < 100; ++i) {
+            v.PushBack(i);
+        }
+        assert(counters.allocated > 0);
+
+        // Аллокатор распространяется на копию и на реаллокации
+        auto v_copy(v);
+        v_copy.PushBack(100);
+        assert(v_copy.GetAllocator().counters == &counters);
+        assert(v[50] == 50);
+    }
+    assert(counters.allocated == counters.deallocated);
+}
+
+void Test8() {
+    const size_t SIZE = 100;
+    {
+        int batch[1000];
+        for (int i = 0; i < 1000; ++i) {
+            batch[i] = i;
+        }
+
+        Vector<int> v;
+        v.Append(batch, 1000);
+        assert(v.Size() == 1000);
+        assert(v.Capacity() == 1000);
+        assert(v[999] == 999);
+
+        // Повторная дозапись укладывается максимум в одну реаллокацию
+        v.AppendRange(std::begin(batch), std::end(batch));
+        assert(v.Size() == 2000);
+        assert(v.Capacity() == 2000);
+        assert(v[1000] == 0);
+    }
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v(SIZE);
+        Vector<Obj> batch(SIZE / 2);
+        const int old_move_count = Obj::num_moved;
+        v.AppendRange(batch.begin(), batch.end());
+        assert(v.Size() == SIZE + SIZE / 2);
+        // Старые элементы перемещены ровно один раз, новые — скопированы
+        assert(Obj::num_moved == old_move_count + static_cast<int>(SIZE));
+        assert(Obj::num_copied == SIZE / 2);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void Test9() {
+    const size_t SIZE = 100;
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v(SIZE);
+        v.Reserve(SIZE * 4);
+        assert(v.Capacity() == SIZE * 4);
+        v.ShrinkToFit();
+        assert(v.Capacity() == SIZE);
+        assert(v.Size() == SIZE);
+        assert(Obj::GetAliveObjectCount() == SIZE);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        Vector<int> v;
+        v.PushBack(1);
+        v.PopBack();
+        v.ShrinkToFit();
+        assert(v.Capacity() == 0);
+        assert(v.Size() == 0);
+    }
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v(SIZE);
+        auto storage = v.ReleaseStorage();
+        assert(v.Size() == 0);
+        assert(v.Capacity() == 0);
+        assert(storage.Capacity() == SIZE);
+        assert(Obj::GetAliveObjectCount() == SIZE);
+        v.DestroyN(storage.GetAddress(), SIZE);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void Test10() {
+    const size_t SIZE = 1000;
+    {
+        Vector<char> v(SIZE, DefaultInitTag{});
+        assert(v.Size() == SIZE);
+        assert(v.Capacity() == SIZE);
+        // Буфер готов к записи «снаружи» без предварительного обнуления
+        for (size_t i = 0; i < SIZE; ++i) {
+            v[i] = static_cast<char>(i % 128);
+        }
+        assert(v[100] == 100);
+    }
+    {
+        Vector<int> v;
+        v.ResizeUninitialized(SIZE);
+        assert(v.Size() == SIZE);
+        assert(v.Capacity() == SIZE);
+        v[SIZE - 1] = 42;
+
+        v.ResizeUninitialized(SIZE / 2);
+        assert(v.Size() == SIZE / 2);
+        assert(v.Capacity() == SIZE);
+
+        v.ResizeUninitialized(SIZE);
+        assert(v.Size() == SIZE);
+        assert(v.Capacity() == SIZE);
+    }
+}
+
+void Test11() {
+    {
+        Vector<int> v;
+        for (int i = 0; i < 10; ++i) {
+            v.PushBack(i);
+        }
+
+        // Удаление диапазона [2, 5) одним сдвигом хвоста
+        auto it = v.Erase(v.cbegin() + 2, v.cbegin() + 5);
+        assert(v.Size() == 7);
+        assert(*it == 5);
+        assert(v[0] == 0 && v[1] == 1 && v[2] == 5 && v[6] == 9);
+
+        // Пустой диапазон ничего не меняет
+        it = v.Erase(v.cbegin() + 3, v.cbegin() + 3);
+        assert(v.Size() == 7);
+        assert(*it == 6);
+    }
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v;
+        for (int i = 0; i < 5; ++i) {
+            v.EmplaceBack(i);
+        }
+
+        const int old_move_count = Obj::num_moved;
+        auto it = v.EraseSwapLast(v.cbegin() + 1);
+        assert(v.Size() == 4);
+        assert(it->id == 4);
+        assert(v[1].id == 4);
+        // Один move-assign вместо сдвига всего хвоста
+        assert(Obj::num_moved == old_move_count);
+
+        v.EraseSwapLast(v.cbegin() + 3);
+        assert(v.Size() == 3);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void Test12() {
+    {
+        int batch[] = {100, 101, 102};
+
+        Vector<int> v;
+        for (int i = 0; i < 10; ++i) {
+            v.PushBack(i);
+        }
+
+        // Вставка с реаллокацией: голова, диапазон и хвост размещаются по одному разу
+        auto it = v.Insert(v.cbegin() + 4, std::begin(batch), std::end(batch));
+        assert(v.Size() == 13);
+        assert(*it == 100);
+        assert(v[3] == 3 && v[4] == 100 && v[6] == 102 && v[7] == 4 && v[12] == 9);
+    }
+    {
+        Vector<int> v;
+        v.Reserve(100);
+        for (int i = 0; i < 10; ++i) {
+            v.PushBack(i);
+        }
+
+        // Вставка на месте: и узкое окно (count < tail), и широкое (count >= tail)
+        int narrow[] = {-1, -2};
+        v.Insert(v.cbegin() + 2, std::begin(narrow), std::end(narrow));
+        assert(v.Size() == 12);
+        assert(v[1] == 1 && v[2] == -1 && v[3] == -2 && v[4] == 2 && v[11] == 9);
+
+        int wide[] = {7, 7, 7, 7, 7};
+        v.Insert(v.cbegin() + 10, std::begin(wide), std::end(wide));
+        assert(v.Size() == 17);
+        assert(v[9] == 7 && v[10] == 7 && v[14] == 7 && v[15] == 8 && v[16] == 9);
+
+        auto it = v.Insert(v.cend(), std::begin(narrow), std::begin(narrow));
+        assert(it == v.end());
+        assert(v.Size() == 17);
+    }
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v(10);
+        Vector<Obj> batch(3);
+        v.Insert(v.cbegin() + 5, batch.begin(), batch.end());
+        assert(v.Size() == 13);
+        assert(Obj::GetAliveObjectCount() == 13 + 3);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void Test13() {
+    {
+        // Фиксированный шаг роста вместо удвоения
+        Vector<int, NewDeleteAllocator<int>, GrowthFixedIncrement<10>> v;
+        v.PushBack(0);
+        assert(v.Capacity() == 10);
+        for (int i = 1; i < 11; ++i) {
+            v.PushBack(i);
+        }
+        assert(v.Capacity() == 20);
+        assert(v.Size() == 11);
+        assert(v[10] == 10);
+    }
+    {
+        Vector<int, NewDeleteAllocator<int>, GrowthOneAndHalf> v;
+        size_t last_capacity = 0;
+        for (int i = 0; i < 1000; ++i) {
+            v.PushBack(i);
+            assert(v.Capacity() >= last_capacity);
+            // Рост не превышает полуторакратного
+            assert(last_capacity == 0 || v.Capacity() <= last_capacity + last_capacity / 2 + 1);
+            last_capacity = v.Capacity();
+        }
+        assert(v[999] == 999);
+    }
+}
+
+void Test14() {
+    {
+        // 64-байтное выравнивание под AVX-512-загрузки
+        Vector<float, AlignedAllocator<float, 64>> v;
+        for (int i = 0; i < 1000; ++i) {
+            v.PushBack(static_cast<float>(i));
+        }
+        assert(reinterpret_cast<uintptr_t>(&v[0]) % 64 == 0);
+        assert(v[999] == 999.0f);
+
+        v.Reserve(10'000);
+        assert(reinterpret_cast<uintptr_t>(&v[0]) % 64 == 0);
+    }
+    {
+        const size_t SIZE = 4 * 1024 * 1024;
+        Vector<char, HugePageAllocator<char>> v(SIZE, DefaultInitTag{});
+        assert(reinterpret_cast<uintptr_t>(&v[0]) % (2 * 1024 * 1024) == 0);
+        v[SIZE - 1] = 1;
+        assert(v[SIZE - 1] == 1);
+    }
+}
+
+void Test15() {
+    const char* PATH = "/tmp/advanced_vector_file_test.bin";
+    std::remove(PATH);
+    {
+        FileVector<uint64_t> v(PATH);
+        assert(v.Size() == 0);
+        for (uint64_t i = 0; i < 10'000; ++i) {
+            v.PushBack(i * 3);
+        }
+        v.Resize(20'000);
+        assert(v.Size() == 20'000);
+        assert(v[15'000] == 0);
+        v.Flush();
+    }
+    {
+        // Повторное открытие снапшота — O(1), данные на месте
+        FileVector<uint64_t> v(PATH);
+        assert(v.Size() == 20'000);
+        assert(v[9'999] == 9'999 * 3);
+
+        uint64_t batch[] = {1, 2, 3};
+        v.Append(batch, 3);
+        assert(v.Size() == 20'003);
+        assert(v[20'002] == 3);
+
+        // Дозапись в свободную ёмкость не вызывает рост
+        const size_t cap_before = v.Capacity();
+        assert(cap_before > v.Size() + 3);
+        v.Append(batch, 3);
+        assert(v.Capacity() == cap_before);
+    }
+    {
+        // Несовпадение формата элемента отлавливается по заголовку
+        try {
+            FileVector<uint32_t> v(PATH);
+            assert(false && "Exception is expected");
+        } catch (const std::runtime_error&) {
+        }
+    }
+    std::remove(PATH);
+    {
+        // 64-байтный заголовок не сбивает выравнивание широких записей
+        struct alignas(16) WideRecord {
+            double lo;
+            double hi;
+        };
+        const char* WIDE_PATH = "/tmp/advanced_vector_file_align_test.bin";
+        std::remove(WIDE_PATH);
+        FileVector<WideRecord> v(WIDE_PATH);
+        v.PushBack(WideRecord{1.0, 2.0});
+        assert(reinterpret_cast<uintptr_t>(&v[0]) % alignof(WideRecord) == 0);
+        assert(v[0].hi == 2.0);
+        std::remove(WIDE_PATH);
+    }
+}
+
+void Test16() {
+    const size_t SIZE = 1'000'000;
+    using ParVector = Vector<int, NewDeleteAllocator<int>, GrowthDoubling, ParallelExecution<1024>>;
+    {
+        ParVector v(SIZE);
+        assert(v.Size() == SIZE);
+        assert(v[0] == 0 && v[SIZE / 2] == 0 && v[SIZE - 1] == 0);
+
+        v[SIZE / 2] = 42;
+        v.Reserve(SIZE * 2);
+        assert(v[SIZE / 2] == 42);
+
+        v.Resize(SIZE * 2);
+        assert(v[SIZE * 2 - 1] == 0);
+        v.Resize(SIZE / 2);
+        assert(v.Size() == SIZE / 2);
+    }
+    {
+        Vector<ParObj, NewDeleteAllocator<ParObj>, GrowthDoubling, ParallelExecution<1024>> v(SIZE);
+        assert(ParObj::alive.load() == static_cast<int>(SIZE));
+        v.Reserve(SIZE * 2);
+        assert(ParObj::alive.load() == static_cast<int>(SIZE));
+    }
+    assert(ParObj::alive.load() == 0);
+}
+
+void Test17() {
+    using namespace std::literals;
+    {
+        Reloc::ResetCounters();
+        Vector<Reloc> v;
+        for (int i = 0; i < 100; ++i) {
+            v.EmplaceBack("object-number-"s + std::to_string(i));
+        }
+        // Все реаллокации прошли побайтово: ни копий, ни перемещений
+        assert(Reloc::num_copied == 0);
+        assert(Reloc::num_moved == 0);
+        assert(v.Size() == 100);
+        assert(v[0].Name() == "object-number-0"s);
+        assert(v[99].Name() == "object-number-99"s);
+
+        v.Reserve(1000);
+        assert(Reloc::num_copied == 0);
+        assert(v[42].Name() == "object-number-42"s);
+    }
+    {
+        Reloc::ResetCounters();
+        SmallVector<Reloc, 2> v;
+        for (int i = 0; i < 20; ++i) {
+            v.EmplaceBack(std::to_string(i));
+        }
+        assert(Reloc::num_copied == 0);
+        assert(Reloc::num_moved == 0);
+        assert(v[19].Name() == "19"s);
+    }
+}
+
+void Test18() {
+    const size_t PRODUCERS = 4;
+    const size_t PER_PRODUCER = 10'000;
+    {
+        ConcurrentVector<uint64_t> v(PRODUCERS * PER_PRODUCER);
+
+        std::thread producers[PRODUCERS];
+        for (size_t p = 0; p < PRODUCERS; ++p) {
+            producers[p] = std::thread([&v, p] {
+                for (size_t i = 0; i < PER_PRODUCER; ++i) {
+                    const bool ok = v.TryEmplaceBack(p * PER_PRODUCER + i);
+                    assert(ok);
+                }
+            });
+        }
+        for (auto& t : producers) {
+            t.join();
+        }
+
+        assert(v.Size() == PRODUCERS * PER_PRODUCER);
+        // Все значения на месте, каждое ровно один раз
+        uint64_t sum = 0;
+        for (uint64_t value : v) {
+            sum += value;
+        }
+        const uint64_t n = PRODUCERS * PER_PRODUCER;
+        assert(sum == n * (n - 1) / 2);
+
+        // Переполнение ёмкости — отказ без исключения
+        assert(!v.TryPushBack(0));
+
+        v.Clear();
+        assert(v.Size() == 0);
+        assert(v.TryPushBack(7));
+        assert(v[0] == 7);
+    }
+    {
+        ConcurrentVector<uint64_t> v(4);
+        for (uint64_t i = 0; i < 4; ++i) {
+            v.TryPushBack(i);
+        }
+        v.Reserve(16);
+        assert(v.Capacity() == 16);
+        assert(v.Size() == 4);
+        assert(v[3] == 3);
+        assert(v.TryPushBack(4));
+    }
+}
+
+void Test19() {
+    using namespace std::literals;
+    {
+        SoaVector<int, double, std::string> v;
+        for (int i = 0; i < 1000; ++i) {
+            v.PushBack(i, i * 0.5, std::to_string(i));
+        }
+        assert(v.Size() == 1000);
+
+        // Скан одной колонки — плотное чтение без соседних полей
+        const int* ids = v.Field<0>();
+        long long sum = 0;
+        for (size_t i = 0; i < v.Size(); ++i) {
+            sum += ids[i];
+        }
+        assert(sum == 999 * 1000 / 2);
+
+        auto [id, weight, name] = v[500];
+        assert(id == 500);
+        assert(weight == 250.0);
+        assert(name == "500"s);
+        id = -1;
+        assert(v.Field<0>(500) == -1);
+
+        v.Resize(10);
+        assert(v.Size() == 10);
+        v.Resize(50);
+        assert(v.Field<2>(20).empty());
+
+        size_t count = 0;
+        for (auto [i, d, s] : v) {
+            (void)i;
+            (void)d;
+            (void)s;
+            ++count;
+        }
+        assert(count == 50);
+
+        v.PopBack();
+        assert(v.Size() == 49);
+    }
+    {
+        SoaVector<int, int> a;
+        a.PushBack(1, 2);
+        SoaVector<int, int> b(std::move(a));
+        assert(b.Size() == 1);
+        assert(a.Size() == 0);
+        assert(std::get<1>(b[0]) == 2);
+    }
+    {
+        // Выброс при переносе второй колонки: копии первой колонки в новом
+        // буфере должны быть разрушены, а не утечь вместе с ним
+        CopyReloc::alive = 0;
+        {
+            SoaVector<CopyReloc, CopyReloc> v;
+            for (int i = 0; i < 8; ++i) {
+                v.PushBack(CopyReloc(i), CopyReloc(i * 10));
+            }
+            const int alive_before = CopyReloc::alive;
+
+            // Первая колонка переносится целиком, вторая бросает на середине
+            CopyReloc::copies_until_throw = 8 + 4;
+            try {
+                v.Reserve(100);
+                assert(false && "Exception is expected");
+            } catch (const std::runtime_error&) {
+            }
+            CopyReloc::copies_until_throw = -1;
+
+            assert(CopyReloc::alive == alive_before);
+            assert(v.Size() == 8);
+            assert(std::get<1>(v[7]).value == 70);
+        }
+        assert(CopyReloc::alive == 0);
+    }
+    {
+        // Выброс на втором поле PushBack не теряет уже сконструированное первое
+        Obj::ResetCounters();
+        {
+            SoaVector<Obj, Obj> v;
+            Obj a(1);
+            Obj b(2);
+            v.PushBack(a, b);
+
+            b.throw_on_copy = true;
+            try {
+                v.PushBack(a, b);
+                assert(false && "Exception is expected");
+            } catch (const std::runtime_error&) {
+            }
+            assert(v.Size() == 1);
+            assert(Obj::GetAliveObjectCount() == 4);  // a, b и два поля в v
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+}
+
+void Test20() {
+    using namespace std::literals;
+    {
+        Vector<uint32_t> v(1000);
+        v.Fill(7);
+        assert(v[0] == 7 && v[999] == 7);
+
+        v[777] = 42;
+        auto it = v.Find(42);
+        assert(it == v.begin() + 777);
+        assert(v.Find(43) == v.end());
+
+        const auto& cv = v;
+        assert(cv.Find(42) == cv.begin() + 777);
+
+        Vector<uint32_t> w(v);
+        assert(v.Equal(w));
+        w[500] = 0;
+        assert(!v.Equal(w));
+
+        uint32_t batch[] = {1, 2, 3, 4, 5};
+        v.Assign(std::begin(batch), std::end(batch));
+        assert(v.Size() == 5);
+        assert(v[4] == 5);
+
+        // Указатель на конвертируемый, но другой тип — поэлементный путь,
+        // memcpy читал бы источник не тем шагом
+        Vector<uint64_t> wide(8);
+        wide.Assign(std::begin(batch), std::end(batch));
+        assert(wide.Size() == 5);
+        assert(wide[0] == 1 && wide[4] == 5);
+    }
+    {
+        // Скалярный запасной путь для нетривиальных типов
+        Vector<std::string> v;
+        v.PushBack("alpha"s);
+        v.PushBack("beta"s);
+        v.PushBack("gamma"s);
+        assert(v.Find("beta"s) == v.begin() + 1);
+        assert(v.Find("delta"s) == v.end());
+
+        Vector<std::string> w;
+        w.Assign(v.begin(), v.end());
+        assert(w.Equal(v));
+        w.Fill("x"s);
+        assert(w[2] == "x"s);
+        assert(!w.Equal(v));
+    }
+    {
+        Vector<uint8_t> v(64);
+        v.Fill(uint8_t{0xAB});
+        assert(v[63] == 0xAB);
+        v[1] = 1;
+        assert(v.Find(uint8_t{1}) == v.begin() + 1);
+    }
+    {
+        Vector<uint64_t> v(100);
+        v[99] = ~0ull;
+        assert(v.Find(~0ull) == v.begin() + 99);
+    }
+}
+
+void Test21() {
+    // Политика по умолчанию не увеличивает размер объекта
+    static_assert(sizeof(Vector<int>) == sizeof(RawMemory<int>) + sizeof(size_t));
+    {
+        Vector<int, NewDeleteAllocator<int>, GrowthDoubling, SerialExecution, CollectStats> v;
+        for (int i = 0; i < 100; ++i) {
+            v.PushBack(i);
+        }
+
+        const auto stats = v.Stats();
+        assert(stats.reallocations > 0);
+        assert(stats.bytes_moved > 0);
+        assert(stats.peak_capacity == v.Capacity());
+        assert(stats.slack == v.Capacity() - v.Size());
+
+        const size_t reallocs_before = stats.reallocations;
+        v.Reserve(1000);
+        const auto after = v.Stats();
+        assert(after.reallocations == reallocs_before + 1);
+        assert(after.peak_capacity == 1000);
+        assert(after.bytes_moved >= stats.bytes_moved + 100 * sizeof(int));
+    }
+    {
+        Vector<int> v(100);
+        const auto stats = v.Stats();
+        assert(stats.reallocations == 0);
+        assert(stats.slack == 0);
+    }
+}
+
+// Таблица, вычисленная Vector'ом на этапе компиляции
+constexpr int SumOfSquares(int n) {
+    Vector<int> v;
+    for (int i = 0; i < n; ++i) {
+        v.PushBack(i * i);
+    }
+
+    Vector<int> copy(v);
+    copy.Resize(static_cast<size_t>(n) / 2);
+    copy.Resize(static_cast<size_t>(n));  // дозаполнение нулями
+
+    int sum = 0;
+    for (int x : v) {
+        sum += x;
+    }
+    for (size_t i = copy.Size() / 2; i < copy.Size(); ++i) {
+        sum += copy[i];
+    }
+    return sum;
+}
+
+void Test22() {
+    static_assert(SumOfSquares(10) == 285);
+    static_assert([] {
+        Vector<int> v(3);
+        v.Reserve(8);
+        v.PushBack(42);
+        v.PopBack();
+        Vector<int> other = std::move(v);
+        other = other;
+        return other.Size() == 3 && other.Capacity() == 8;
+    }());
+
+    // Тот же код обязан работать и в рантайме
+    assert(SumOfSquares(10) == 285);
+}
+
+void Test23() {
+    using namespace std::literals;
+    {
+        // Forward-итераторы: ровно одна аллокация под известный размер
+        const int src[] = {1, 2, 3, 4, 5};
+        AllocCounters counters;
+        Vector<int, CountingAllocator<int>> v(std::begin(src), std::end(src),
+                                              CountingAllocator<int>{&counters});
+        assert(v.Size() == 5);
+        assert(v.Capacity() == 5);
+        assert(counters.allocated == 1);
+        assert(std::equal(v.begin(), v.end(), std::begin(src)));
+    }
+    {
+        Vector<std::string> v{"alpha"s, "beta"s, "gamma"s};
+        assert(v.Size() == 3);
+        assert(v[1] == "beta"s);
+    }
+    {
+        // Input-итераторы: подсказка размера избавляет от дорастания
+        std::istringstream stream("10 20 30 40");
+        Vector<int> v(std::istream_iterator<int>(stream), std::istream_iterator<int>(), 4);
+        assert(v.Size() == 4);
+        assert(v.Capacity() == 4);
+        assert(v[0] == 10 && v[3] == 40);
+    }
+    {
+        Vector<int> empty(std::initializer_list<int>{});
+        assert(empty.Size() == 0);
+    }
+    {
+        // Однопроходные источники в AppendRange/Insert/Assign: std::distance
+        // поглотил бы поток до копирования
+        Vector<int> v;
+        std::istringstream append_src("1 2 3");
+        v.AppendRange(std::istream_iterator<int>(append_src), std::istream_iterator<int>());
+        assert(v.Size() == 3);
+        assert(v[0] == 1 && v[2] == 3);
+
+        std::istringstream insert_src("10 20");
+        v.Insert(v.begin() + 1, std::istream_iterator<int>(insert_src),
+                 std::istream_iterator<int>());
+        assert(v.Size() == 5);
+        assert(v[0] == 1 && v[1] == 10 && v[2] == 20 && v[3] == 2);
+
+        std::istringstream assign_short("7 8");
+        v.Assign(std::istream_iterator<int>(assign_short), std::istream_iterator<int>());
+        assert(v.Size() == 2);
+        assert(v[0] == 7 && v[1] == 8);
+
+        std::istringstream assign_long("1 2 3 4 5 6");
+        v.Assign(std::istream_iterator<int>(assign_long), std::istream_iterator<int>());
+        assert(v.Size() == 6);
+        assert(v[0] == 1 && v[5] == 6);
+    }
+}
+
+void Test24() {
+    using NoThrowVector = Vector<int, NewDeleteAllocator<int>, GrowthDoubling, SerialExecution,
+                                 NoStats, AssumeNoThrowConstruction>;
+    // Политика не добавляет состояния
+    static_assert(sizeof(NoThrowVector) == sizeof(Vector<int>));
+
+    NoThrowVector v;
+    for (int i = 0; i < 10; ++i) {
+        v.PushBack(i);
+    }
+    v.Emplace(v.begin() + 5, 100);
+    assert(v.Size() == 11);
+    assert(v[4] == 4 && v[5] == 100 && v[6] == 5 && v[10] == 9);
+
+    v.Insert(v.begin(), -1);
+    assert(v[0] == -1 && v[1] == 0);
+
+    // Путь без защитной копии работает и для нетривиальных типов
+    Obj::ResetCounters();
+    {
+        Vector<Obj, NewDeleteAllocator<Obj>, GrowthDoubling, SerialExecution,
+               NoStats, AssumeNoThrowConstruction> objs;
+        objs.Reserve(8);
+        for (int i = 0; i < 4; ++i) {
+            objs.EmplaceBack(i);
+        }
+        objs.Emplace(objs.begin() + 2, 42);
+        assert(objs.Size() == 5);
+        assert(objs[2].id == 42 && objs[3].id == 2);
+        assert(Obj::GetAliveObjectCount() == 5);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void Test25() {
+    using SharedVector = Vector<Obj, NewDeleteAllocator<Obj>, GrowthDoubling, SerialExecution,
+                                NoStats, StrongExceptionGuarantee, EnableSnapshots>;
+    Obj::ResetCounters();
+    {
+        SharedVector v;
+        for (int i = 0; i < 8; ++i) {
+            v.EmplaceBack(i);
+        }
+
+        auto snap = v.Snapshot();
+        assert(snap.Size() == 8);
+        const Obj* snap_data = snap.begin();
+
+        // Рост писателя не трогает буфер снимка: элементы копируются
+        const int copies_before = Obj::num_copied;
+        while (v.Capacity() == 8) {
+            v.EmplaceBack(100);
+        }
+        assert(Obj::num_copied >= copies_before + 8);
+        assert(snap.begin() == snap_data);
+        for (size_t i = 0; i < snap.Size(); ++i) {
+            assert(snap[i].id == static_cast<int>(i));
+        }
+
+        // Второй снимок видит уже новый буфер
+        auto snap2 = v.Snapshot();
+        assert(snap2.Size() == v.Size());
+        assert(snap2.begin() != snap.begin());
+
+        // Дальнейшие append-ы в пределах ёмкости не ломают оба снимка
+        v.EmplaceBack(200);
+        assert(snap[7].id == 7);
+        assert(snap2[8].id == 100);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+
+    // Снимок переживает писателя
+    Obj::ResetCounters();
+    {
+        SharedVector v;
+        v.EmplaceBack(1);
+        v.EmplaceBack(2);
+        auto snap = [&v] {
+            auto inner = v.Snapshot();
+            SharedVector dead(std::move(v));
+            return inner;
+        }();
+        assert(snap.Size() == 2);
+        assert(snap[0].id == 1 && snap[1].id == 2);
+
+        auto snap_copy = snap;
+        assert(snap_copy[1].id == 2);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void Test26() {
+    {
+        Vector<int> v;
+        for (int i = 0; i < 1000; ++i) {
+            v.PushBack(i / 3);  // дубликаты: 0,0,0,1,1,1,...
+        }
+
+        for (int probe = -1; probe <= 335; ++probe) {
+            assert(v.LowerBound(probe) == std::lower_bound(v.begin(), v.end(), probe));
+            assert(v.UpperBound(probe) == std::upper_bound(v.begin(), v.end(), probe));
+            assert(v.Contains(probe) == std::binary_search(v.begin(), v.end(), probe));
+        }
+    }
+    {
+        Vector<int> empty;
+        assert(empty.LowerBound(5) == empty.end());
+        assert(empty.UpperBound(5) == empty.end());
+        assert(!empty.Contains(5));
+    }
+    {
+        Vector<std::string> v;
+        v.PushBack("apple");
+        v.PushBack("banana");
+        v.PushBack("cherry");
+        assert(v.Contains("banana"));
+        assert(!v.Contains("durian"));
+        assert(v.LowerBound("b") == v.begin() + 1);
+    }
+}
+
+void Test27() {
+    const size_t N = 300'000;  // выше порога — параллельные пути
+    {
+        Vector<int> v;
+        v.Reserve(N);
+        uint32_t state = 12345;
+        for (size_t i = 0; i < N; ++i) {
+            state = state * 1664525 + 1013904223;
+            v.PushBack(static_cast<int>(state % 1000));
+        }
+
+        Vector<int> expected(v);
+        std::sort(expected.begin(), expected.end());
+
+        v.ParallelSort();
+        assert(v.Equal(expected));
+
+        v.ParallelSort(std::greater<int>{});
+        assert(std::is_sorted(v.begin(), v.end(), std::greater<int>{}));
+    }
+    {
+        Vector<long> v(N);
+        for (size_t i = 0; i < N; ++i) {
+            v[i] = static_cast<long>(i);
+        }
+
+        v.ParallelForEach([](long& x) { x *= 2; });
+        assert(v[0] == 0 && v[1] == 2 && v[N - 1] == 2 * static_cast<long>(N - 1));
+
+        const long sum = v.ParallelReduce(0L, [](long acc, long x) { return acc + x; });
+        assert(sum == static_cast<long>(N - 1) * static_cast<long>(N));
+    }
+    {
+        // Ниже порога — последовательный путь
+        Vector<int> small;
+        for (int i = 10; i > 0; --i) {
+            small.PushBack(i);
+        }
+        small.ParallelSort();
+        assert(std::is_sorted(small.begin(), small.end()));
+        assert(small.ParallelReduce(0, [](int acc, int x) { return acc + x; }) == 55);
+    }
+}
+
+void Test28() {
+    const char* path = "/tmp/advanced_vector_huge_test.bin";
+    {
+        // 10 сегментов при окне в 2: вытеснение и подгрузка неизбежны
+        HugeVector<int, 1024> v(path, 2);
+        for (int i = 0; i < 10'000; ++i) {
+            v.PushBack(i * 7);
+        }
+        assert(v.Size() == 10'000);
+        assert(v.SegmentCount() == 10);
+        assert(v.ResidentSegments() <= 2);
+
+        // Случайный доступ через холодные сегменты
+        assert(v[0] == 0);
+        assert(v[9'999] == 9'999 * 7);
+        assert(v[5'000] == 5'000 * 7);
+        assert(v.ResidentSegments() <= 2);
+
+        // Модификация с последующим вытеснением и перечитыванием
+        v[123] = -1;
+        for (int i = 0; i < 3'000; ++i) {
+            (void)v[9'000 - i];  // выталкиваем сегмент с v[123]
+        }
+        assert(v[123] == -1);
+
+        long long sum = 0;
+        for (int x : v) {
+            sum += x;
+        }
+        const long long expected = 7LL * 9'999 * 10'000 / 2 - 123 * 7 - 1;
+        assert(sum == expected);
+    }
+    {
+        // Запрошенное окно в 1 сегмент клампится до 2: последний затронутый
+        // сегмент закреплён, ссылки двух соседних обращений живы одновременно
+        HugeVector<uint64_t, 256> small(path, 1);
+        for (uint64_t i = 0; i < 1'000; ++i) {
+            small.PushBack(i);
+        }
+        assert(small.ResidentSegments() <= 2);
+        for (uint64_t i = 0; i < 1'000; i += 111) {
+            assert(small[static_cast<size_t>(i)] == i);
+        }
+
+        // Операнды из разных сегментов: второй subscript не должен вытеснить
+        // сегмент первого до чтения
+        assert(small[0] + small[999] == 999);
+        assert(small[999] + small[0] == 999);
+    }
+}
+
+void Test29() {
+    Obj::ResetCounters();
+    {
+        Vector<Obj> v;
+        for (int i = 0; i < 1000; ++i) {
+            v.EmplaceBack(i);
+        }
+        assert(Obj::GetAliveObjectCount() == 1000);
+
+        // Разрушение уезжает в фоновый поток, вектор мгновенно пуст и пригоден
+        std::thread reclaimer;
+        v.DetachAndReclaim([&reclaimer](auto task) {
+            reclaimer = std::thread(std::move(task));
+        });
+        assert(v.Size() == 0);
+        assert(v.Capacity() == 0);
+        v.EmplaceBack(42);
+        assert(v[0].id == 42);
+
+        reclaimer.join();
+        assert(Obj::GetAliveObjectCount() == 1);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+
+    // Инлайновый executor эквивалентен обычному разрушению
+    Obj::ResetCounters();
+    {
+        Vector<Obj> v;
+        v.EmplaceBack(1);
+        v.DetachAndReclaim([](auto task) { task(); });
+        assert(Obj::GetAliveObjectCount() == 0);
+        assert(v.Size() == 0);
+    }
+}
+
+void Test30() {
+    Obj::ResetCounters();
+    {
+        StaticVector<Obj, 64> v;
+        static_assert(v.Capacity() == 64);
+        assert(v.Empty());
+
+        for (int i = 0; i < 64; ++i) {
+            v.EmplaceBack(i);
+        }
+        assert(v.Full());
+        assert(Obj::GetAliveObjectCount() == 64);
+        assert(v[63].id == 63);
+
+        v.PopBack();
+        auto it = v.Erase(v.begin() + 10);
+        assert(it->id == 11);
+        assert(v.Size() == 62);
+
+        StaticVector<Obj, 64> copy(v);
+        assert(copy.Size() == 62);
+        assert(copy[0].id == 0);
+
+        StaticVector<Obj, 64> moved(std::move(copy));
+        assert(moved.Size() == 62 && copy.Size() == 0);
+
+        v.Clear();
+        assert(v.Empty());
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void Test31() {
+    {
+        Vector<uint64_t> v;
+        uint64_t state = 88172645463325252ull;
+        for (int i = 0; i < 100'000; ++i) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            v.PushBack(state);
+        }
+
+        Vector<uint64_t> expected(v);
+        std::sort(expected.begin(), expected.end());
+
+        v.RadixSort();
+        assert(v.Equal(expected));
+    }
+    {
+        // Знаковые ключи: отрицательные впереди
+        Vector<int> v{3, -1, 0, -100, 42, -7, 1'000'000, -1'000'000};
+        v.RadixSort();
+        assert(std::is_sorted(v.begin(), v.end()));
+        assert(v[0] == -1'000'000);
+    }
+    {
+        // Сортировка записей по ключу стабильна
+        struct Trade {
+            uint32_t ts;
+            int seq;
+        };
+        Vector<Trade> v;
+        for (int i = 0; i < 10'000; ++i) {
+            v.PushBack(Trade{static_cast<uint32_t>((i * 7919) % 100), i});
+        }
+
+        v.RadixSortByKey([](const Trade& t) { return t.ts; });
+
+        for (size_t i = 1; i < v.Size(); ++i) {
+            assert(v[i - 1].ts <= v[i].ts);
+            if (v[i - 1].ts == v[i].ts) {
+                assert(v[i - 1].seq < v[i].seq);
+            }
+        }
+    }
+}
+
+namespace {
+
+std::atomic<int> overflow_calls{0};
+
+void CountOverflow(size_t /*requested*/, size_t /*limit*/) {
+    ++overflow_calls;
+}
+
+}  // namespace
+
+void Test32() {
+    const size_t baseline = MemoryBudget::Used();
+    MemoryBudget::SetLimit(baseline + 64 * 1024);
+    MemoryBudget::SetOverflowCallback(CountOverflow);
+
+    {
+        Vector<int> v;
+        assert(v.TryReserve(1'000));
+        assert(MemoryBudget::Used() >= baseline + 1'000 * sizeof(int));
+
+        // Запрос на мегабайты упирается в бюджет: false вместо исключения
+        assert(!v.TryReserve(1'000'000));
+        assert(overflow_calls.load() == 1);
+        assert(v.Capacity() == 1'000);
+
+        int pushed = 0;
+        while (v.TryPushBack(pushed)) {
+            ++pushed;
+        }
+        assert(pushed >= 1'000);  // рост остановился на бюджете, не раньше
+        assert(overflow_calls.load() == 2);
+        assert(v.Size() == static_cast<size_t>(pushed));
+
+        // Бросающий путь сохраняет прежнее поведение
+        try {
+            v.Reserve(1'000'000);
+            assert(false && "Exception is expected");
+        } catch (const std::bad_alloc&) {
+        }
+    }
+
+    // Буферы освобождены — бюджет вернулся к исходному
+    assert(MemoryBudget::Used() == baseline);
+
+    MemoryBudget::SetOverflowCallback(nullptr);
+    MemoryBudget::SetLimit(0);
+}
+
+void Test33() {
+    {
+        // Через байтовый буфер
+        Vector<int> v;
+        for (int i = 0; i < 1'000; ++i) {
+            v.PushBack(i * 3);
+        }
+
+        Vector<unsigned char> bytes(v.SerializedSize(), DefaultInitTag{});
+        const size_t written = v.WriteTo(bytes.begin(), bytes.Size());
+        assert(written == v.SerializedSize());
+
+        Vector<int> restored;
+        const size_t consumed = restored.ReadFrom(bytes.begin(), bytes.Size());
+        assert(consumed == written);
+        assert(restored.Equal(v));
+    }
+    {
+        // Через файловый дескриптор: writev-заголовок + содержимое
+        struct Trade {
+            uint64_t ts;
+            double price;
+        };
+        Vector<Trade> v;
+        for (int i = 0; i < 10'000; ++i) {
+            v.PushBack(Trade{static_cast<uint64_t>(i), i * 0.5});
+        }
+
+        const char* path = "/tmp/advanced_vector_wire_test.bin";
+        int fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+        assert(fd >= 0);
+        v.WriteTo(fd);
+        ::lseek(fd, 0, SEEK_SET);
+
+        Vector<Trade> restored;
+        restored.ReadFrom(fd);
+        assert(restored.Size() == v.Size());
+        assert(restored[9'999].ts == 9'999 && restored[123].price == 123 * 0.5);
+        ::close(fd);
+        ::unlink(path);
+    }
+    {
+        // Несовпадение формата обнаруживается по заголовку
+        Vector<int> ints;
+        ints.PushBack(1);
+        Vector<unsigned char> bytes(ints.SerializedSize(), DefaultInitTag{});
+        ints.WriteTo(bytes.begin(), bytes.Size());
+
+        Vector<double> wrong;
+        try {
+            wrong.ReadFrom(bytes.begin(), bytes.Size());
+            assert(false && "Exception is expected");
+        } catch (const std::runtime_error&) {
+        }
+    }
+    {
+        // Враждебный заголовок: size * sizeof(T) переполняет size_t, проверка
+        // усечения не должна его пропустить
+        Vector<int> v;
+        v.PushBack(42);
+        Vector<unsigned char> bytes(v.SerializedSize(), DefaultInitTag{});
+        v.WriteTo(bytes.begin(), bytes.Size());
+
+        uint64_t huge = uint64_t(1) << 62;
+        std::memcpy(bytes.begin() + 16, &huge, sizeof huge);
+
+        Vector<int> victim;
+        try {
+            victim.ReadFrom(bytes.begin(), bytes.Size());
+            assert(false && "Exception is expected");
+        } catch (const std::runtime_error&) {
+        }
+        assert(victim.Size() == 0);
+    }
+    {
+        // Широкие записи: payload лежит на 24-м байте буфера, то есть
+        // невыровнен для alignof == 16 — путь чтения не должен требовать
+        // выравнивания
+        struct alignas(16) WideRecord {
+            double lo;
+            double hi;
+        };
+        Vector<WideRecord> v;
+        for (int i = 0; i < 100; ++i) {
+            v.PushBack(WideRecord{i * 1.0, i * 2.0});
+        }
+
+        Vector<unsigned char> bytes(v.SerializedSize(), DefaultInitTag{});
+        v.WriteTo(bytes.begin(), bytes.Size());
+
+        Vector<WideRecord> restored;
+        restored.ReadFrom(bytes.begin(), bytes.Size());
+        assert(restored.Size() == 100);
+        assert(restored[99].lo == 99.0 && restored[99].hi == 198.0);
+    }
+}
+
 int main() {
     try {
         Test1();
@@ -387,6 +1734,34 @@ int main() {
         Test3();
         Test4();
         Test5();
+        Test6();
+        Test7();
+        Test8();
+        Test9();
+        Test10();
+        Test11();
+        Test12();
+        Test13();
+        Test14();
+        Test15();
+        Test16();
+        Test17();
+        Test18();
+        Test19();
+        Test20();
+        Test21();
+        Test22();
+        Test23();
+        Test24();
+        Test25();
+        Test26();
+        Test27();
+        Test28();
+        Test29();
+        Test30();
+        Test31();
+        Test32();
+        Test33();
     } catch (const std::exception& e) {
         std::cerr << e.what() << std::endl;
     }
@@ -0,0 +1,193 @@
+#pragma once
+
+#include "vector.h"
+
+template <typename T, size_t N>
+class SmallVector {
+    static_assert(N > 0, "Inline capacity must be positive");
+
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    SmallVector() = default;
+
+    explicit SmallVector(size_t size) {
+        Reserve(size);
+        std::uninitialized_value_construct_n(Data(), size);
+        size_ = size;
+    }
+
+    SmallVector(const SmallVector& other) {
+        Reserve(other.size_);
+        std::uninitialized_copy_n(other.Data(), other.size_, Data());
+        size_ = other.size_;
+    }
+
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (!other.IsInline()) {
+            heap_ = std::move(other.heap_);
+            size_ = other.size_;
+            other.size_ = 0;
+        } else {
+            std::uninitialized_move_n(other.Data(), other.size_, Data());
+            size_ = other.size_;
+            std::destroy_n(other.Data(), other.size_);
+            other.size_ = 0;
+        }
+    }
+
+    SmallVector& operator=(const SmallVector& rhs) {
+        if (this != &rhs) {
+            SmallVector temp(rhs);
+            *this = std::move(temp);
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& rhs) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this == &rhs) return *this;
+
+        std::destroy_n(Data(), size_);
+        size_ = 0;
+
+        if (!rhs.IsInline()) {
+            heap_ = std::move(rhs.heap_);
+            size_ = rhs.size_;
+            rhs.size_ = 0;
+        } else {
+            std::uninitialized_move_n(rhs.Data(), rhs.size_, Data());
+            size_ = rhs.size_;
+            std::destroy_n(rhs.Data(), rhs.size_);
+            rhs.size_ = 0;
+        }
+        return *this;
+    }
+
+    ~SmallVector() {
+        std::destroy_n(Data(), size_);
+    }
+
+    iterator begin() noexcept {
+        return Data();
+    }
+
+    iterator end() noexcept {
+        return Data() + size_;
+    }
+
+    const_iterator begin() const noexcept {
+        return Data();
+    }
+
+    const_iterator end() const noexcept {
+        return Data() + size_;
+    }
+
+    const_iterator cbegin() const noexcept {
+        return Data();
+    }
+
+    const_iterator cend() const noexcept {
+        return Data() + size_;
+    }
+
+    void Swap(SmallVector& other) {
+        if (!IsInline() && !other.IsInline()) {
+            heap_.Swap(other.heap_);
+            std::swap(size_, other.size_);
+            return;
+        }
+
+        SmallVector temp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return IsInline() ? N : heap_.Capacity();
+    }
+
+    bool IsInline() const noexcept {
+        return heap_.Capacity() == 0;
+    }
+
+    void Reserve(size_t capacity) {
+        if (capacity <= Capacity()) return;
+
+        RawMemory<T> newData(capacity);
+
+        RelocateN(Data(), size_, newData.GetAddress());
+
+        DestroyRelocatedN(Data(), size_);
+        heap_ = std::move(newData);
+    }
+
+    void PushBack(const T& value) {
+        EmplaceBack(value);
+    }
+
+    void PushBack(T&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    void PopBack() noexcept {
+        if (size_ == 0) return;
+
+        std::destroy_at(Data() + size_ - 1);
+        --size_;
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        if (size_ < Capacity()) {
+            T* ptr = new (Data() + size_) T(std::forward<Args>(args)...);
+            ++size_;
+            return *ptr;
+        }
+
+        RawMemory<T> newData(Capacity() * 2);
+
+        RelocateN(Data(), size_, newData.GetAddress());
+
+        T* ptr = nullptr;
+        try {
+            ptr = new (newData.GetAddress() + size_) T(std::forward<Args>(args)...);
+        } catch (...) {
+            DestroyRelocatedN(newData.GetAddress(), size_);
+            throw;
+        }
+
+        DestroyRelocatedN(Data(), size_);
+        heap_ = std::move(newData);
+        ++size_;
+        return *ptr;
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return const_cast<SmallVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept {
+        assert(index < size_);
+        return Data()[index];
+    }
+
+private:
+    T* Data() noexcept {
+        return IsInline() ? reinterpret_cast<T*>(inline_buf_) : heap_.GetAddress();
+    }
+
+    const T* Data() const noexcept {
+        return const_cast<SmallVector&>(*this).Data();
+    }
+
+private:
+    alignas(T) unsigned char inline_buf_[N * sizeof(T)];
+    RawMemory<T> heap_;
+    size_t size_ = 0;
+};
@@ -0,0 +1,228 @@
+#pragma once
+
+#include "vector.h"
+
+#include <tuple>
+
+// Structure-of-arrays вариант вектора: каждое поле записи живёт в собственном
+// RawMemory, поэтому скан одного поля — плотное последовательное чтение без
+// протаскивания холодных байтов соседних полей через кэш. Рост всех полей
+// синхронизирован; доступ к элементу — кортеж ссылок на поля.
+template <typename... Ts>
+class SoaVector {
+    static_assert(sizeof...(Ts) > 0, "SoaVector requires at least one field");
+
+public:
+    SoaVector() = default;
+
+    SoaVector(const SoaVector&) = delete;
+    SoaVector& operator=(const SoaVector&) = delete;
+
+    SoaVector(SoaVector&& other) noexcept
+        : data_(std::move(other.data_))
+        , capacity_(other.capacity_)
+        , size_(other.size_) {
+        other.capacity_ = 0;
+        other.size_ = 0;
+    }
+
+    SoaVector& operator=(SoaVector&& rhs) noexcept {
+        if (this != &rhs) {
+            Swap(rhs);
+        }
+        return *this;
+    }
+
+    ~SoaVector() {
+        DestroyRange(0, size_);
+    }
+
+    void Swap(SoaVector& other) noexcept {
+        SwapImpl(other, Fields{});
+        std::swap(capacity_, other.capacity_);
+        std::swap(size_, other.size_);
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return capacity_;
+    }
+
+    // Перенос полей независим; при выбросе из копирующего переноса даётся
+    // базовая гарантия (в отличие от одноколоночного Vector)
+    void Reserve(size_t capacity) {
+        if (capacity <= capacity_) return;
+
+        std::tuple<RawMemory<Ts>...> newData{RawMemory<Ts>(capacity)...};
+        RelocateAll(newData, Fields{});
+        capacity_ = capacity;
+    }
+
+    void Resize(size_t new_size) {
+        if (new_size < size_) {
+            DestroyRange(new_size, size_);
+            size_ = new_size;
+            return;
+        }
+
+        if (new_size > capacity_) {
+            Reserve(GrowthDoubling::Grow(capacity_, new_size));
+        }
+        ConstructRange(size_, new_size);
+        size_ = new_size;
+    }
+
+    void PushBack(const Ts&... values) {
+        if (size_ == capacity_) {
+            Reserve(GrowthDoubling::Grow(capacity_, size_ + 1));
+        }
+        PushBackImpl(Fields{}, values...);
+        ++size_;
+    }
+
+    void PopBack() noexcept {
+        if (size_ == 0) return;
+
+        DestroyRange(size_ - 1, size_);
+        --size_;
+    }
+
+    // Плотный указатель на колонку I — для сканов и автовекторизации
+    template <size_t I>
+    auto* Field() noexcept {
+        return std::get<I>(data_).GetAddress();
+    }
+
+    template <size_t I>
+    const auto* Field() const noexcept {
+        return std::get<I>(data_).GetAddress();
+    }
+
+    template <size_t I>
+    auto& Field(size_t index) noexcept {
+        assert(index < size_);
+        return std::get<I>(data_)[index];
+    }
+
+    std::tuple<Ts&...> operator[](size_t index) noexcept {
+        assert(index < size_);
+        return ElementAt(index, Fields{});
+    }
+
+    std::tuple<const Ts&...> operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return const_cast<SoaVector&>(*this).ElementAt(index, Fields{});
+    }
+
+    class Iterator {
+    public:
+        Iterator(SoaVector* owner, size_t index) noexcept
+            : owner_(owner), index_(index) {
+        }
+
+        std::tuple<Ts&...> operator*() const noexcept {
+            return (*owner_)[index_];
+        }
+
+        Iterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        bool operator==(const Iterator& rhs) const noexcept = default;
+
+    private:
+        SoaVector* owner_;
+        size_t index_;
+    };
+
+    Iterator begin() noexcept {
+        return Iterator(this, 0);
+    }
+
+    Iterator end() noexcept {
+        return Iterator(this, size_);
+    }
+
+private:
+    using Fields = std::index_sequence_for<Ts...>;
+
+    template <size_t... Is>
+    void SwapImpl(SoaVector& other, std::index_sequence<Is...>) noexcept {
+        (std::get<Is>(data_).Swap(std::get<Is>(other.data_)), ...);
+    }
+
+    template <size_t... Is>
+    void RelocateAll(std::tuple<RawMemory<Ts>...>& to, std::index_sequence<Is...>) {
+        size_t done = 0;
+        try {
+            ((RelocateN(std::get<Is>(data_).GetAddress(), size_,
+                        std::get<Is>(to).GetAddress()), ++done), ...);
+        } catch (...) {
+            // Перенесённые колонки в to иначе утекли бы: RawMemory освобождает
+            // байты без деструкторов. Для побайтово перенесённых колонок
+            // владение остаётся у источника, их копии не разрушаем —
+            // DestroyRelocatedN различает это сам
+            size_t i = 0;
+            auto rollback = [&](auto* ptr) {
+                if (i++ < done) {
+                    DestroyRelocatedN(ptr, size_);
+                }
+            };
+            (rollback(std::get<Is>(to).GetAddress()), ...);
+            throw;
+        }
+        (DestroyRelocatedN(std::get<Is>(data_).GetAddress(), size_), ...);
+        (std::get<Is>(data_).Swap(std::get<Is>(to)), ...);
+    }
+
+    template <size_t... Is>
+    void PushBackImpl(std::index_sequence<Is...>, const Ts&... values) {
+        size_t done = 0;
+        try {
+            ((new (std::get<Is>(data_).GetAddress() + size_) Ts(values), ++done), ...);
+        } catch (...) {
+            // Поля, сконструированные до выбросившего, разрушаем сразу:
+            // size_ не вырос, деструктор вектора их не увидит
+            size_t i = 0;
+            auto rollback = [&](auto* ptr) {
+                if (i++ < done) {
+                    std::destroy_at(ptr);
+                }
+            };
+            (rollback(std::get<Is>(data_).GetAddress() + size_), ...);
+            throw;
+        }
+    }
+
+    template <size_t... Is>
+    std::tuple<Ts&...> ElementAt(size_t index, std::index_sequence<Is...>) noexcept {
+        return std::tie(std::get<Is>(data_)[index]...);
+    }
+
+    void DestroyRange(size_t from, size_t to) noexcept {
+        DestroyRangeImpl(from, to, Fields{});
+    }
+
+    template <size_t... Is>
+    void DestroyRangeImpl(size_t from, size_t to, std::index_sequence<Is...>) noexcept {
+        (std::destroy_n(std::get<Is>(data_).GetAddress() + from, to - from), ...);
+    }
+
+    void ConstructRange(size_t from, size_t to) {
+        ConstructRangeImpl(from, to, Fields{});
+    }
+
+    template <size_t... Is>
+    void ConstructRangeImpl(size_t from, size_t to, std::index_sequence<Is...>) {
+        (std::uninitialized_value_construct_n(std::get<Is>(data_).GetAddress() + from, to - from), ...);
+    }
+
+private:
+    std::tuple<RawMemory<Ts>...> data_;
+    size_t capacity_ = 0;
+    size_t size_ = 0;
+};
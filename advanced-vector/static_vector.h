@@ -0,0 +1,159 @@
+#pragma once
+
+#include "vector.h"
+
+// Вектор с фиксированной на этапе компиляции ёмкостью: хранилище — выровненный
+// байтовый массив внутри объекта, кучи и ветки роста нет вовсе. Переполнение —
+// ошибка программирования и ловится только debug-assert'ом, как выход за
+// границы в RawMemory::operator[]
+template <typename T, size_t N>
+class StaticVector {
+    static_assert(N > 0, "Capacity must be positive");
+
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    StaticVector() = default;
+
+    explicit StaticVector(size_t size) {
+        assert(size <= N);
+        std::uninitialized_value_construct_n(Data(), size);
+        size_ = size;
+    }
+
+    StaticVector(const StaticVector& other) {
+        std::uninitialized_copy_n(other.Data(), other.size_, Data());
+        size_ = other.size_;
+    }
+
+    StaticVector(StaticVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        std::uninitialized_move_n(other.Data(), other.size_, Data());
+        size_ = other.size_;
+        std::destroy_n(other.Data(), other.size_);
+        other.size_ = 0;
+    }
+
+    StaticVector& operator=(const StaticVector& rhs) {
+        if (this != &rhs) {
+            StaticVector temp(rhs);
+            *this = std::move(temp);
+        }
+        return *this;
+    }
+
+    StaticVector& operator=(StaticVector&& rhs) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this == &rhs) return *this;
+
+        std::destroy_n(Data(), size_);
+        size_ = 0;
+        std::uninitialized_move_n(rhs.Data(), rhs.size_, Data());
+        size_ = rhs.size_;
+        std::destroy_n(rhs.Data(), rhs.size_);
+        rhs.size_ = 0;
+        return *this;
+    }
+
+    ~StaticVector() {
+        std::destroy_n(Data(), size_);
+    }
+
+    iterator begin() noexcept {
+        return Data();
+    }
+
+    iterator end() noexcept {
+        return Data() + size_;
+    }
+
+    const_iterator begin() const noexcept {
+        return Data();
+    }
+
+    const_iterator end() const noexcept {
+        return Data() + size_;
+    }
+
+    const_iterator cbegin() const noexcept {
+        return Data();
+    }
+
+    const_iterator cend() const noexcept {
+        return Data() + size_;
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    static constexpr size_t Capacity() noexcept {
+        return N;
+    }
+
+    bool Empty() const noexcept {
+        return size_ == 0;
+    }
+
+    bool Full() const noexcept {
+        return size_ == N;
+    }
+
+    void PushBack(const T& value) {
+        EmplaceBack(value);
+    }
+
+    void PushBack(T&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        assert(size_ < N);
+        T* ptr = new (Data() + size_) T(std::forward<Args>(args)...);
+        ++size_;
+        return *ptr;
+    }
+
+    void PopBack() noexcept {
+        assert(size_ > 0);
+        std::destroy_at(Data() + size_ - 1);
+        --size_;
+    }
+
+    void Clear() noexcept {
+        std::destroy_n(Data(), size_);
+        size_ = 0;
+    }
+
+    iterator Erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>) {
+        assert(pos >= cbegin() && pos < cend());
+
+        const size_t index = static_cast<size_t>(pos - cbegin());
+        std::move(Data() + index + 1, Data() + size_, Data() + index);
+        std::destroy_at(Data() + size_ - 1);
+        --size_;
+        return Data() + index;
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return const_cast<StaticVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept {
+        assert(index < size_);
+        return Data()[index];
+    }
+
+private:
+    T* Data() noexcept {
+        return reinterpret_cast<T*>(buf_);
+    }
+
+    const T* Data() const noexcept {
+        return const_cast<StaticVector&>(*this).Data();
+    }
+
+private:
+    alignas(T) unsigned char buf_[N * sizeof(T)];
+    size_t size_ = 0;
+};
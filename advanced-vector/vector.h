@@ -1,120 +1,681 @@
 #pragma once
 
 #include <cassert>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <numeric>
 #include <new>
 #include <memory>
 #include <utility>
 #include <algorithm>
 #include <type_traits>
 #include <stdexcept>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ADVANCED_VECTOR_X86 1
+#endif
+
+struct DefaultInitTag {};
+
+// Многопроходность итератора: однопроходные (input) источники нельзя мерить
+// std::distance перед копированием
+template <typename It>
+inline constexpr bool IsForwardIterator =
+    std::is_base_of_v<std::forward_iterator_tag,
+                      typename std::iterator_traits<It>::iterator_category>;
+
+struct GrowthDoubling {
+    static constexpr size_t Grow(size_t capacity, size_t needed) {
+        return std::max(needed, capacity == 0 ? size_t(1) : capacity * 2);
+    }
+};
+
+struct GrowthOneAndHalf {
+    static constexpr size_t Grow(size_t capacity, size_t needed) {
+        return std::max(needed, capacity + std::max<size_t>(capacity / 2, 1));
+    }
+};
+
+template <size_t Increment>
+struct GrowthFixedIncrement {
+    static_assert(Increment > 0, "Increment must be positive");
+
+    static constexpr size_t Grow(size_t capacity, size_t needed) {
+        return std::max(needed, capacity + Increment);
+    }
+};
+
+// Процессный бюджет байтов под буферы векторов: нулевой лимит — без
+// ограничений. Growth-пути сверяются с ним через аллокаторы до выделения;
+// при отказе синхронно вызывается зарегистрированный колбэк, чтобы логика
+// шеддинга реагировала без раскрутки исключений
+class MemoryBudget {
+public:
+    using OverflowCallback = void (*)(size_t requested, size_t limit);
+
+    static void SetLimit(size_t bytes) noexcept {
+        limit_.store(bytes, std::memory_order_relaxed);
+    }
+
+    static size_t Limit() noexcept {
+        return limit_.load(std::memory_order_relaxed);
+    }
+
+    static size_t Used() noexcept {
+        return used_.load(std::memory_order_relaxed);
+    }
+
+    static void SetOverflowCallback(OverflowCallback callback) noexcept {
+        callback_.store(callback, std::memory_order_relaxed);
+    }
+
+    static bool TryCharge(size_t bytes) noexcept {
+        const size_t limit = limit_.load(std::memory_order_relaxed);
+        size_t used = used_.load(std::memory_order_relaxed);
+        do {
+            if (limit != 0 && used + bytes > limit) {
+                if (OverflowCallback callback = callback_.load(std::memory_order_relaxed)) {
+                    callback(bytes, limit);
+                }
+                return false;
+            }
+        } while (!used_.compare_exchange_weak(used, used + bytes, std::memory_order_relaxed));
+        return true;
+    }
+
+    static void Release(size_t bytes) noexcept {
+        used_.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+private:
+    static inline std::atomic<size_t> limit_{0};
+    static inline std::atomic<size_t> used_{0};
+    static inline std::atomic<OverflowCallback> callback_{nullptr};
+};
+
+template <typename T>
+struct NewDeleteAllocator {
+    constexpr T* Allocate(size_t n) {
+        if (n == 0) {
+            return nullptr;
+        }
+        if (std::is_constant_evaluated()) {
+            return std::allocator<T>{}.allocate(n);
+        }
+        if (!MemoryBudget::TryCharge(n * sizeof(T))) {
+            throw std::bad_alloc{};
+        }
+        try {
+            return static_cast<T*>(operator new(n * sizeof(T)));
+        } catch (...) {
+            MemoryBudget::Release(n * sizeof(T));
+            throw;
+        }
+    }
+
+    constexpr void Deallocate(T* buf, size_t n) noexcept {
+        if (std::is_constant_evaluated()) {
+            if (buf != nullptr) {
+                std::allocator<T>{}.deallocate(buf, n);
+            }
+            return;
+        }
+        if (buf != nullptr) {
+            MemoryBudget::Release(n * sizeof(T));
+        }
+        operator delete(buf);
+    }
+};
+
+inline constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+
+// Выравненное выделение; при HugePages буферы дополнительно выравниваются
+// на 2 МБ и помечаются madvise(MADV_HUGEPAGE) для прозрачных больших страниц
+template <typename T, size_t Alignment = alignof(T), bool HugePages = false>
+struct AlignedAllocator {
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+    static_assert(Alignment >= alignof(T), "Alignment must not weaken the natural alignment of T");
+
+    static constexpr size_t kEffectiveAlignment = HugePages ? std::max(Alignment, kHugePageSize) : Alignment;
+
+    T* Allocate(size_t n) {
+        if (n == 0) {
+            return nullptr;
+        }
+        const size_t bytes = n * sizeof(T);
+        void* buf = operator new(bytes, std::align_val_t{kEffectiveAlignment});
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        if constexpr (HugePages) {
+            if (bytes >= kHugePageSize) {
+                madvise(buf, bytes, MADV_HUGEPAGE);
+            }
+        }
+#endif
+        return static_cast<T*>(buf);
+    }
+
+    void Deallocate(T* buf, size_t /*n*/) noexcept {
+        operator delete(buf, std::align_val_t{kEffectiveAlignment});
+    }
+};
+
+template <typename T, size_t Alignment = alignof(T)>
+using HugePageAllocator = AlignedAllocator<T, Alignment, true>;
+
+// Типы, которые можно переносить побайтово (memcpy без вызова деструктора
+// источника). По умолчанию — тривиально копируемые; пользователь может
+// специализировать трейт для своих типов, безопасно переезжающих по памяти
+template <typename T>
+struct TriviallyRelocatable : std::is_trivially_copyable<T> {};
+
+// Снимок счётчиков горячего пути, пригодный для экспорта в метрики
+struct VectorStats {
+    size_t reallocations = 0;
+    size_t bytes_moved = 0;
+    size_t peak_capacity = 0;
+    size_t slack = 0;
+};
+
+// Политика по умолчанию: пустой тип, все хуки схлопываются в no-op
+struct NoStats {
+    static constexpr bool kEnabled = false;
+
+    constexpr void OnReallocation(size_t /*elements_moved*/, size_t /*element_size*/) noexcept {
+    }
 
+    constexpr void OnCapacity(size_t /*capacity*/) noexcept {
+    }
+};
+
+struct CollectStats {
+    static constexpr bool kEnabled = true;
+
+    constexpr void OnReallocation(size_t elements_moved, size_t element_size) noexcept {
+        ++reallocations;
+        bytes_moved += elements_moved * element_size;
+    }
+
+    constexpr void OnCapacity(size_t capacity) noexcept {
+        peak_capacity = std::max(peak_capacity, capacity);
+    }
+
+    size_t reallocations = 0;
+    size_t bytes_moved = 0;
+    size_t peak_capacity = 0;
+};
+
+// Политики исключений при вставке: по умолчанию — строгая гарантия с
+// try/catch-откатами; AssumeNoThrowConstruction вычёркивает их на этапе
+// компиляции вместе с защитной временной копией в Emplace (вставляемое
+// значение не должно ссылаться на элементы самого вектора)
+struct StrongExceptionGuarantee {
+    static constexpr bool kAssumeNoThrow = false;
+};
+
+struct AssumeNoThrowConstruction {
+    static constexpr bool kAssumeNoThrow = true;
+};
+
+// Разделяемые снимки читателей (см. Vector::Snapshot). Отдельная политика:
+// выключенный режим не добавляет вектору ни состояния, ни ветвлений
+struct NoSnapshots {
+    static constexpr bool kEnabled = false;
+};
+
+struct EnableSnapshots {
+    static constexpr bool kEnabled = true;
+};
+
+template <typename T>
+constexpr void RelocateN(T* from, size_t count, T* to) {
+    if (std::is_constant_evaluated()) {
+        // В константных вычислениях memcpy недоступен — поэлементный перенос
+        for (size_t i = 0; i < count; ++i) {
+            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+                std::construct_at(to + i, std::move(from[i]));
+            } else {
+                std::construct_at(to + i, from[i]);
+            }
+        }
+        return;
+    }
+    if constexpr (TriviallyRelocatable<T>::value) {
+        if (count != 0) {
+            std::memcpy(static_cast<void*>(to), static_cast<const void*>(from), count * sizeof(T));
+        }
+    } else if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+        std::uninitialized_move_n(from, count, to);
+    } else {
+        std::uninitialized_copy_n(from, count, to);
+    }
+}
+
+#if defined(ADVANCED_VECTOR_X86)
+inline bool HasAvx2() {
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    return has_avx2;
+}
+
+// Явное AVX2-ядро поиска: 32 байта за итерацию вместо скалярного цикла
+template <typename T>
+__attribute__((target("avx2")))
+const T* FindAvx2(const T* first, size_t count, T value) {
+    constexpr size_t kLane = 32 / sizeof(T);
+    __m256i needle;
+    if constexpr (sizeof(T) == 1) {
+        needle = _mm256_set1_epi8(static_cast<char>(value));
+    } else if constexpr (sizeof(T) == 2) {
+        needle = _mm256_set1_epi16(static_cast<short>(value));
+    } else if constexpr (sizeof(T) == 4) {
+        needle = _mm256_set1_epi32(static_cast<int>(value));
+    } else {
+        needle = _mm256_set1_epi64x(static_cast<long long>(value));
+    }
+
+    size_t i = 0;
+    for (; i + kLane <= count; i += kLane) {
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i));
+        __m256i eq;
+        if constexpr (sizeof(T) == 1) {
+            eq = _mm256_cmpeq_epi8(chunk, needle);
+        } else if constexpr (sizeof(T) == 2) {
+            eq = _mm256_cmpeq_epi16(chunk, needle);
+        } else if constexpr (sizeof(T) == 4) {
+            eq = _mm256_cmpeq_epi32(chunk, needle);
+        } else {
+            eq = _mm256_cmpeq_epi64(chunk, needle);
+        }
+        const unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(eq));
+        if (mask != 0) {
+            return first + i + static_cast<size_t>(__builtin_ctz(mask)) / sizeof(T);
+        }
+    }
+    for (; i < count; ++i) {
+        if (first[i] == value) {
+            return first + i;
+        }
+    }
+    return first + count;
+}
+#endif  // ADVANCED_VECTOR_X86
+
+// Поиск по непрерывному буферу; для целочисленных типов диспетчеризуется
+// в AVX2-ядро, когда процессор его поддерживает
+template <typename T>
+const T* SimdFindN(const T* first, size_t count, const T& value) {
+#if defined(ADVANCED_VECTOR_X86)
+    if constexpr (std::is_integral_v<T> &&
+                  (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)) {
+        if (HasAvx2()) {
+            return FindAvx2(first, count, value);
+        }
+    }
+#endif
+    return std::find(first, first + count, value);
+}
+
+template <typename T>
+constexpr void CopyConstructN(const T* from, size_t count, T* to) {
+    if (std::is_constant_evaluated()) {
+        for (size_t i = 0; i < count; ++i) {
+            std::construct_at(to + i, from[i]);
+        }
+        return;
+    }
+    std::uninitialized_copy_n(from, count, to);
+}
+
+// Бинарный поиск без ветвлений: смещение базы вычисляется условным
+// перемещением (cmov) вместо непредсказуемого перехода, а префетч середин
+// обеих будущих половин прячет кэш-промах следующего шага
+template <typename T, typename Compare>
+const T* BranchlessLowerBound(const T* first, size_t count, const T& value, Compare comp) {
+    while (count > 1) {
+        const size_t half = count / 2;
+        __builtin_prefetch(first + half / 2);
+        __builtin_prefetch(first + half + half / 2);
+        first += comp(first[half - 1], value) ? half : 0;
+        count -= half;
+    }
+    if (count == 1 && comp(*first, value)) {
+        ++first;
+    }
+    return first;
+}
+
+// Разрушение источника после RelocateN: для побайтово перенесённых типов
+// деструкторы пропускаются — владение ресурсами уже у копий
 template <typename T>
+constexpr void DestroyRelocatedN([[maybe_unused]] T* from, [[maybe_unused]] size_t count) noexcept {
+    if (std::is_constant_evaluated()) {
+        std::destroy_n(from, count);
+        return;
+    }
+    if constexpr (!TriviallyRelocatable<T>::value) {
+        std::destroy_n(from, count);
+    }
+}
+
+struct SerialExecution {
+    template <typename T>
+    static constexpr void ConstructN(T* first, size_t count) {
+        if (std::is_constant_evaluated()) {
+            for (size_t i = 0; i < count; ++i) {
+                std::construct_at(first + i);
+            }
+            return;
+        }
+        std::uninitialized_value_construct_n(first, count);
+    }
+
+    template <typename T>
+    static constexpr void DestroyN(T* first, size_t count) noexcept {
+        std::destroy_n(first, count);
+    }
+
+    template <typename T>
+    static constexpr void RelocateRange(T* from, size_t count, T* to) {
+        RelocateN(from, count, to);
+    }
+};
+
+// Массовое конструирование/разрушение/перенос делятся между потоками,
+// когда диапазон не короче Threshold элементов; гарантии безопасности
+// исключений сохраняются попартиционно
+template <size_t Threshold = (size_t(1) << 16)>
+struct ParallelExecution {
+    template <typename T>
+    static void ConstructN(T* first, size_t count) {
+        RunChunks(
+            count,
+            [first](size_t begin, size_t end) {
+                std::uninitialized_value_construct_n(first + begin, end - begin);
+            },
+            [first](size_t begin, size_t end) {
+                std::destroy_n(first + begin, end - begin);
+            });
+    }
+
+    template <typename T>
+    static void DestroyN(T* first, size_t count) noexcept {
+        RunChunks(
+            count,
+            [first](size_t begin, size_t end) {
+                std::destroy_n(first + begin, end - begin);
+            },
+            [](size_t, size_t) {});
+    }
+
+    template <typename T>
+    static void RelocateRange(T* from, size_t count, T* to) {
+        RunChunks(
+            count,
+            [from, to](size_t begin, size_t end) {
+                RelocateN(from + begin, end - begin, to + begin);
+            },
+            [to](size_t begin, size_t end) {
+                DestroyRelocatedN(to + begin, end - begin);
+            });
+    }
+
+private:
+    // Выполняет work на отрезках [begin, end); при исключении в любом из
+    // потоков откатывает успешно обработанные отрезки через undo
+    template <typename Work, typename Undo>
+    static void RunChunks(size_t count, Work work, Undo undo) {
+        size_t workers = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        workers = std::min(workers, count / Threshold);
+
+        if (workers <= 1) {
+            work(0, count);
+            return;
+        }
+
+        const size_t chunk = (count + workers - 1) / workers;
+        std::unique_ptr<std::thread[]> threads;
+        std::unique_ptr<std::atomic<bool>[]> done;
+        try {
+            threads = std::make_unique<std::thread[]>(workers);
+            done = std::make_unique<std::atomic<bool>[]>(workers);
+        } catch (const std::bad_alloc&) {
+            // DestroyN обязан быть noexcept: без памяти под служебные массивы
+            // просто работаем последовательно
+            work(0, count);
+            return;
+        }
+        std::atomic<bool> failed{false};
+        std::exception_ptr error;
+        std::mutex error_mutex;
+
+        size_t spawned = 0;
+        for (size_t w = 0; w < workers; ++w) {
+            const size_t begin = w * chunk;
+            const size_t end = std::min(count, begin + chunk);
+            done[w].store(false);
+            auto task = [&, w, begin, end] {
+                try {
+                    work(begin, end);
+                    done[w].store(true);
+                } catch (...) {
+                    failed.store(true);
+                    std::lock_guard<std::mutex> guard(error_mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+            };
+            if (spawned == w) {
+                try {
+                    threads[w] = std::thread(task);
+                    ++spawned;
+                    continue;
+                } catch (const std::system_error&) {
+                    // Исчерпание потоков на загруженной машине: из noexcept
+                    // DestroyN это привело бы к terminate. Остаток диапазона
+                    // обрабатывается прямо в вызывающем потоке
+                }
+            }
+            task();
+        }
+        for (size_t w = 0; w < spawned; ++w) {
+            threads[w].join();
+        }
+
+        if (failed.load()) {
+            for (size_t w = 0; w < workers; ++w) {
+                if (done[w].load()) {
+                    const size_t begin = w * chunk;
+                    undo(begin, std::min(count, begin + chunk));
+                }
+            }
+            std::rethrow_exception(error);
+        }
+    }
+};
+
+template <typename T, typename Alloc = NewDeleteAllocator<T>>
 class RawMemory {
 public:
-    RawMemory() = default;
+    constexpr RawMemory() = default;
 
-    explicit RawMemory(size_t capacity)
-        : buffer_(Allocate(capacity))
+    explicit constexpr RawMemory(Alloc alloc) noexcept
+        : alloc_(std::move(alloc)) {
+    }
+
+    explicit constexpr RawMemory(size_t capacity, Alloc alloc = Alloc{})
+        : alloc_(std::move(alloc))
+        , buffer_(alloc_.Allocate(capacity))
         , capacity_(capacity) {
     }
 
     RawMemory(const RawMemory&) = delete;
     RawMemory& operator=(const RawMemory& rhs) = delete;
 
-    RawMemory(RawMemory&& other) noexcept
-        : buffer_(other.buffer_), capacity_(other.capacity_) {
+    constexpr RawMemory(RawMemory&& other) noexcept
+        : alloc_(std::move(other.alloc_)), buffer_(other.buffer_), capacity_(other.capacity_) {
         other.buffer_ = nullptr;
         other.capacity_ = 0;
     }
 
-    RawMemory& operator=(RawMemory&& rhs) noexcept {
+    constexpr RawMemory& operator=(RawMemory&& rhs) noexcept {
         if (this != &rhs) {
             Swap(rhs);
         }
         return *this;
     }
 
-    ~RawMemory() {
-        Deallocate(buffer_);
+    constexpr ~RawMemory() {
+        alloc_.Deallocate(buffer_, capacity_);
     }
 
-    T* operator+(size_t offset) noexcept {
+    constexpr T* operator+(size_t offset) noexcept {
         assert(offset <= capacity_);
         return buffer_ + offset;
     }
 
-    const T* operator+(size_t offset) const noexcept {
+    constexpr const T* operator+(size_t offset) const noexcept {
         return const_cast<RawMemory&>(*this) + offset;
     }
 
-    const T& operator[](size_t index) const noexcept {
+    constexpr const T& operator[](size_t index) const noexcept {
         return const_cast<RawMemory&>(*this)[index];
     }
 
-    T& operator[](size_t index) noexcept {
+    constexpr T& operator[](size_t index) noexcept {
         assert(index < capacity_);
         return buffer_[index];
     }
 
-    void Swap(RawMemory& other) noexcept {
+    constexpr void Swap(RawMemory& other) noexcept {
+        std::swap(alloc_, other.alloc_);
         std::swap(buffer_, other.buffer_);
         std::swap(capacity_, other.capacity_);
     }
 
-    const T* GetAddress() const noexcept {
+    constexpr const T* GetAddress() const noexcept {
         return buffer_;
     }
 
-    T* GetAddress() noexcept {
+    constexpr T* GetAddress() noexcept {
         return buffer_;
     }
 
-    size_t Capacity() const {
+    constexpr size_t Capacity() const {
         return capacity_;
     }
 
-private:
-    static T* Allocate(size_t n) {
-        return n != 0 ? static_cast<T*>(operator new(n * sizeof(T))) : nullptr;
-    }
-
-    static void Deallocate(T* buf) noexcept {
-        operator delete(buf);
+    constexpr const Alloc& GetAllocator() const noexcept {
+        return alloc_;
     }
 
+private:
+    [[no_unique_address]] Alloc alloc_{};
     T* buffer_ = nullptr;
     size_t capacity_ = 0;
 };
 
-template <typename T>
+template <typename T, typename Alloc = NewDeleteAllocator<T>, typename Growth = GrowthDoubling,
+          typename Exec = SerialExecution, typename StatsPolicy = NoStats,
+          typename ExcPolicy = StrongExceptionGuarantee, typename Share = NoSnapshots>
 class Vector {
+    struct SnapshotBlock;
+
 public:
 
-    Vector() = default;
+    constexpr Vector() = default;
+
+    explicit constexpr Vector(Alloc alloc) noexcept
+        : data_(std::move(alloc))
+    {
+    }
+
+    constexpr Vector(size_t size, Alloc alloc = Alloc{})
+        : data_(size, std::move(alloc))
+        , size_(size)
+    {
+        stats_.OnCapacity(Capacity());
+        Exec::ConstructN(data_.GetAddress(), size_);
+    }
 
-    Vector(size_t size)
-        : data_(size)
+    // Выделяет память под size элементов, не инициализируя байты —
+    // для буферов, которые будут целиком перезаписаны извне
+    Vector(size_t size, DefaultInitTag, Alloc alloc = Alloc{})
+        : data_(size, std::move(alloc))
         , size_(size)
     {
-        std::uninitialized_value_construct_n(data_.GetAddress(), size_);
+        static_assert(std::is_trivially_default_constructible_v<T>,
+                      "Default-init mode requires trivially default constructible T");
+    }
+
+    // Для forward-итераторов размер известен заранее — одна аллокация и один
+    // проход uninitialized_copy; для input-итераторов остаётся PushBack-цикл
+    template <typename It, typename Category = typename std::iterator_traits<It>::iterator_category>
+    Vector(It first, It last, Alloc alloc = Alloc{})
+        : data_(std::move(alloc))
+    {
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+            const size_t count = static_cast<size_t>(std::distance(first, last));
+            RawMemory<T, Alloc> newData(count, data_.GetAllocator());
+            stats_.OnCapacity(newData.Capacity());
+            std::uninitialized_copy(first, last, newData.GetAddress());
+            data_.Swap(newData);
+            size_ = count;
+        } else {
+            for (; first != last; ++first) {
+                PushBack(*first);
+            }
+        }
+    }
+
+    // Для input-итераторов (потоков) подсказка размера заменяет std::distance
+    template <typename It, typename = typename std::iterator_traits<It>::iterator_category>
+    Vector(It first, It last, size_t size_hint, Alloc alloc = Alloc{})
+        : data_(size_hint, std::move(alloc))
+    {
+        stats_.OnCapacity(Capacity());
+        for (; first != last; ++first) {
+            PushBack(*first);
+        }
+    }
+
+    Vector(std::initializer_list<T> init, Alloc alloc = Alloc{})
+        : Vector(init.begin(), init.end(), std::move(alloc)) {
     }
 
-    Vector(const Vector& vector)
-        : data_(vector.size_)
+    constexpr Vector(const Vector& vector)
+        : data_(vector.size_, vector.data_.GetAllocator())
         , size_(vector.size_)
     {
-        std::uninitialized_copy_n(vector.data_.GetAddress(), size_, data_.GetAddress());
+        CopyConstructN(vector.data_.GetAddress(), size_, data_.GetAddress());
     }
 
-    Vector(Vector&& other) noexcept
+    constexpr Vector(Vector&& other) noexcept
         : data_(std::move(other.data_))
         , size_(other.size_)
     {
+        if constexpr (Share::kEnabled) {
+            share_.block = std::exchange(other.share_.block, nullptr);
+        }
         other.size_ = 0;
     }
 
-    Vector& operator=(const Vector& rhs) {
+    constexpr Vector& operator=(const Vector& rhs) {
         if (this == &rhs) return *this;
 
         if (rhs.size_ > data_.Capacity()) {
@@ -126,7 +687,7 @@ public:
         return *this;
     }
 
-    Vector& operator=(Vector&& rhs) noexcept {
+    constexpr Vector& operator=(Vector&& rhs) noexcept {
         if (this != &rhs) {
             Swap(rhs);
         }
@@ -136,192 +697,446 @@ public:
     using iterator = T*;
     using const_iterator = const T*;
 
-    iterator begin() noexcept {
+    constexpr iterator begin() noexcept {
         return data_.GetAddress();
     }
 
-    iterator end() noexcept {
+    constexpr iterator end() noexcept {
         return (data_.GetAddress() + size_);
     }
 
-    const_iterator begin() const noexcept {
+    constexpr const_iterator begin() const noexcept {
         return data_.GetAddress();
     }
 
-    const_iterator end() const noexcept {
+    constexpr const_iterator end() const noexcept {
         return (data_.GetAddress() + size_);
     }
 
-    const_iterator cbegin() const noexcept {
+    constexpr const_iterator cbegin() const noexcept {
         return data_.GetAddress();
     }
 
-    const_iterator cend() const noexcept {
+    constexpr const_iterator cend() const noexcept {
         return (data_.GetAddress() + size_);
     }
 
-    void Swap(Vector& other) noexcept {
+    constexpr void Swap(Vector& other) noexcept {
         data_.Swap(other.data_);
         std::swap(size_, other.size_);
+        std::swap(stats_, other.stats_);
+        if constexpr (Share::kEnabled) {
+            std::swap(share_.block, other.share_.block);
+        }
     }
 
-    size_t Size() const noexcept {
+    constexpr size_t Size() const noexcept {
         return size_;
     }
 
-    size_t Capacity() const noexcept {
+    constexpr size_t Capacity() const noexcept {
         return data_.Capacity();
     }
 
-    void Reserve(size_t capacity) {
-        if (capacity <= data_.Capacity()) return;
-
-        RawMemory<T> newData(capacity);
+    constexpr const Alloc& GetAllocator() const noexcept {
+        return data_.GetAllocator();
+    }
 
-        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-            std::uninitialized_move_n(data_.GetAddress(), size_, newData.GetAddress());
-        } else {
-            std::uninitialized_copy_n(data_.GetAddress(), size_, newData.GetAddress());
+    VectorStats Stats() const noexcept {
+        VectorStats snapshot;
+        if constexpr (StatsPolicy::kEnabled) {
+            snapshot.reallocations = stats_.reallocations;
+            snapshot.bytes_moved = stats_.bytes_moved;
+            snapshot.peak_capacity = std::max(stats_.peak_capacity, Capacity());
         }
-
-        std::destroy_n(data_.GetAddress(), size_);
-        data_.Swap(newData);
+        snapshot.slack = Capacity() - size_;
+        return snapshot;
     }
 
-    void Resize(size_t new_size) {
-        if (new_size < size_) {
-            std::destroy_n(data_.GetAddress() + new_size, size_ - new_size);
-            size_ = new_size;
-            return;
+    // Неизменяемый O(1)-снимок текущего содержимого: читатели разделяют буфер
+    // с писателем, а при следующем росте писатель копирует элементы в новый
+    // буфер и оставляет старый во владении снимков. Стабильность гарантируется
+    // для append-only писателя: PopBack/Erase/присваивания по месту меняют
+    // разделяемый буфер под читателями
+    class SnapshotView {
+    public:
+        SnapshotView(const SnapshotView& other) noexcept
+            : block_(other.block_), data_(other.data_), size_(other.size_) {
+            block_->refs.fetch_add(1, std::memory_order_relaxed);
         }
 
-        if (new_size <= Capacity()) {
-            std::uninitialized_value_construct_n(data_.GetAddress() + size_, new_size - size_);
-            size_ = new_size;
-            return;
+        SnapshotView(SnapshotView&& other) noexcept
+            : block_(std::exchange(other.block_, nullptr))
+            , data_(other.data_)
+            , size_(other.size_) {
         }
 
-        size_t new_capacity = std::max(new_size, Capacity() == 0 ? size_t(1) : Capacity() * 2);
-        RawMemory<T> newData(new_capacity);
+        SnapshotView& operator=(const SnapshotView&) = delete;
+        SnapshotView& operator=(SnapshotView&&) = delete;
 
-        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-            std::uninitialized_move_n(data_.GetAddress(), size_, newData.GetAddress());
-        } else {
-            std::uninitialized_copy_n(data_.GetAddress(), size_, newData.GetAddress());
+        ~SnapshotView() {
+            if (block_ != nullptr) {
+                ReleaseSnapshotBlock(block_);
+            }
         }
 
-        std::uninitialized_value_construct_n(newData.GetAddress() + size_, new_size - size_);
+        const T* begin() const noexcept {
+            return data_;
+        }
 
-        std::destroy_n(data_.GetAddress(), size_);
-        data_.Swap(newData);
-        size_ = new_size;
-    }
+        const T* end() const noexcept {
+            return data_ + size_;
+        }
 
-    void PushBack(const T& value) {
-        EmplaceBack(value);
-    }
+        size_t Size() const noexcept {
+            return size_;
+        }
 
-    void PushBack(T&& value) {
-        EmplaceBack(std::move(value));
-    }
+        const T& operator[](size_t index) const noexcept {
+            assert(index < size_);
+            return data_[index];
+        }
 
-    void PopBack() noexcept {
-        if (size_ == 0) return;
+    private:
+        friend class Vector;
 
-        std::destroy_at(data_.GetAddress() + size_ - 1);
-        --size_;
-    }
+        SnapshotView(SnapshotBlock* block, const T* data, size_t size) noexcept
+            : block_(block), data_(data), size_(size) {
+        }
 
-    template <typename... Args>
-    T& EmplaceBack(Args&&... args) {
-        T* ptr = nullptr;
+        SnapshotBlock* block_;
+        const T* data_;
+        size_t size_;
+    };
 
-        if (size_ < Capacity()) {
-            ptr = new (data_.GetAddress() + size_) T(std::forward<Args>(args)...);
-            ++size_;
-            return *ptr;
+    SnapshotView Snapshot() {
+        static_assert(Share::kEnabled, "Snapshot() requires the EnableSnapshots policy");
+        if (share_.block == nullptr) {
+            share_.block = new SnapshotBlock{};
         }
+        share_.block->refs.fetch_add(1, std::memory_order_relaxed);
+        return SnapshotView(share_.block, data_.GetAddress(), size_);
+    }
+
+    constexpr void Reserve(size_t capacity) {
+        if (capacity <= data_.Capacity()) return;
 
-        size_t new_capacity = Capacity() == 0 ? 1 : Capacity() * 2;
-        RawMemory<T> newData(new_capacity);
+        RawMemory<T, Alloc> newData(capacity, data_.GetAllocator());
+        NoteReallocation(size_, newData.Capacity());
 
-        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-            std::uninitialized_move_n(data_.GetAddress(), size_, newData.GetAddress());
-        } else {
-            std::uninitialized_copy_n(data_.GetAddress(), size_, newData.GetAddress());
+        if constexpr (Share::kEnabled) {
+            if (HasLiveSnapshot()) {
+                std::uninitialized_copy_n(data_.GetAddress(), size_, newData.GetAddress());
+                DetachBufferToSnapshot();
+                data_.Swap(newData);
+                return;
+            }
         }
 
+        Relocate(data_.GetAddress(), size_, newData.GetAddress());
+
+        DestroyRelocated(data_.GetAddress(), size_);
+        data_.Swap(newData);
+    }
+
+    // Небросающие варианты для OOM-деградации: отказ бюджета или аллокатора
+    // превращается в false, состояние вектора не меняется
+    bool TryReserve(size_t capacity) noexcept {
         try {
-            ptr = new (newData.GetAddress() + size_) T(std::forward<Args>(args)...);
+            Reserve(capacity);
+            return true;
         } catch (...) {
-            std::destroy_n(newData.GetAddress(), size_);
-            throw;
+            return false;
         }
-
-        std::destroy_n(data_.GetAddress(), size_);
-        data_.Swap(newData);
-        ++size_;
-        return *ptr;
     }
 
-    template <typename... Args>
-    iterator Emplace(const_iterator pos, Args&&... args) {
-        if (pos < begin() || pos > end()) {
-            throw std::out_of_range("Invalid position");
+    bool TryPushBack(const T& value) noexcept {
+        try {
+            PushBack(value);
+            return true;
+        } catch (...) {
+            return false;
         }
+    }
 
-        size_t index = pos - begin();
+    bool TryPushBack(T&& value) noexcept {
+        try {
+            PushBack(std::move(value));
+            return true;
+        } catch (...) {
+            return false;
+        }
+    }
 
-        if (size_ == Capacity()) {
-            size_t new_capacity = (size_ == 0) ? 1 : size_ * 2;
-            RawMemory<T> new_data(new_capacity);
+    void ShrinkToFit() {
+        if (size_ == Capacity()) return;
 
-            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-                std::uninitialized_move_n(data_.GetAddress(), index, new_data.GetAddress());
-            } else {
-                std::uninitialized_copy_n(data_.GetAddress(), index, new_data.GetAddress());
+        if constexpr (Share::kEnabled) {
+            if (HasLiveSnapshot()) {
+                RawMemory<T, Alloc> newData(size_, data_.GetAllocator());
+                std::uninitialized_copy_n(data_.GetAddress(), size_, newData.GetAddress());
+                DetachBufferToSnapshot();
+                data_.Swap(newData);
+                return;
             }
+        }
 
-            T* new_item_ptr = nullptr;
-            try {
-                new_item_ptr = new (new_data.GetAddress() + index) T(std::forward<Args>(args)...);
-            } catch (...) {
-                std::destroy_n(new_data.GetAddress(), index);
-                throw;
-            }
+        if (size_ == 0) {
+            RawMemory<T, Alloc> empty(data_.GetAllocator());
+            data_.Swap(empty);
+            return;
+        }
 
-            try {
-                if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-                    std::uninitialized_move_n(
-                        data_.GetAddress() + index,
-                        size_ - index,
-                        new_data.GetAddress() + index + 1
-                    );
-                } else {
-                    std::uninitialized_copy_n(
-                        data_.GetAddress() + index,
-                        size_ - index,
-                        new_data.GetAddress() + index + 1
-                    );
-                }
+        RawMemory<T, Alloc> newData(size_, data_.GetAllocator());
+        NoteReallocation(size_, newData.Capacity());
+
+        Relocate(data_.GetAddress(), size_, newData.GetAddress());
+
+        DestroyRelocated(data_.GetAddress(), size_);
+        data_.Swap(newData);
+    }
+
+    // Отдаёт буфер вместе с живыми элементами; вектор остаётся пустым.
+    // Разрушение элементов — забота вызывающего (см. DestroyN).
+    RawMemory<T, Alloc> ReleaseStorage() noexcept {
+        RawMemory<T, Alloc> released(data_.GetAllocator());
+        data_.Swap(released);
+        size_ = 0;
+        return released;
+    }
+
+    // O(1)-освобождение на горячем потоке: буфер и работа по разрушению
+    // элементов упаковываются в задачу и передаются executor'у (вызываемому
+    // объекту, принимающему move-only задачу void()); вектор пустеет сразу,
+    // деструкторы отрабатывают там, где executor выполнит задачу
+    template <typename Executor>
+    void DetachAndReclaim(Executor&& executor) {
+        if constexpr (Share::kEnabled) {
+            if (HasLiveSnapshot()) {
+                // Буфером уже владеют снимки — им и разрушать
+                DetachBufferToSnapshot();
+                size_ = 0;
+                return;
+            }
+        }
+
+        executor([count = size_, storage = ReleaseStorage()]() mutable noexcept {
+            std::destroy_n(storage.GetAddress(), count);
+        });
+    }
+
+    constexpr void Resize(size_t new_size) {
+        if (new_size < size_) {
+            Exec::DestroyN(data_.GetAddress() + new_size, size_ - new_size);
+            size_ = new_size;
+            return;
+        }
+
+        if constexpr (Share::kEnabled) {
+            if (new_size > Capacity() && HasLiveSnapshot()) {
+                Reserve(GrowCapacity(new_size));
+            }
+        }
+
+        if (new_size <= Capacity()) {
+            Exec::ConstructN(data_.GetAddress() + size_, new_size - size_);
+            size_ = new_size;
+            return;
+        }
+
+        RawMemory<T, Alloc> newData(GrowCapacity(new_size), data_.GetAllocator());
+        NoteReallocation(size_, newData.Capacity());
+
+        Relocate(data_.GetAddress(), size_, newData.GetAddress());
+
+        Exec::ConstructN(newData.GetAddress() + size_, new_size - size_);
+
+        DestroyRelocated(data_.GetAddress(), size_);
+        data_.Swap(newData);
+        size_ = new_size;
+    }
+
+    void ResizeUninitialized(size_t new_size) {
+        static_assert(std::is_trivially_default_constructible_v<T>,
+                      "ResizeUninitialized requires trivially default constructible T");
+
+        if (new_size < size_) {
+            std::destroy_n(data_.GetAddress() + new_size, size_ - new_size);
+            size_ = new_size;
+            return;
+        }
+
+        if (new_size > Capacity()) {
+            Reserve(GrowCapacity(new_size));
+        }
+        size_ = new_size;
+    }
+
+    constexpr void PushBack(const T& value) {
+        EmplaceBack(value);
+    }
+
+    constexpr void PushBack(T&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    template <typename It>
+    void AppendRange(It first, It last) {
+        // Input-итератор — однопроходный: std::distance поглотил бы источник
+        if constexpr (!IsForwardIterator<It>) {
+            for (; first != last; ++first) {
+                PushBack(*first);
+            }
+            return;
+        }
+
+        const size_t count = static_cast<size_t>(std::distance(first, last));
+        if (count == 0) return;
+
+        if constexpr (Share::kEnabled) {
+            if (size_ + count > Capacity() && HasLiveSnapshot()) {
+                Reserve(GrowCapacity(size_ + count));
+            }
+        }
+
+        if (size_ + count <= Capacity()) {
+            std::uninitialized_copy(first, last, data_.GetAddress() + size_);
+            size_ += count;
+            return;
+        }
+
+        RawMemory<T, Alloc> newData(GrowCapacity(size_ + count), data_.GetAllocator());
+        NoteReallocation(size_, newData.Capacity());
+
+        Relocate(data_.GetAddress(), size_, newData.GetAddress());
+
+        try {
+            std::uninitialized_copy(first, last, newData.GetAddress() + size_);
+        } catch (...) {
+            DestroyRelocated(newData.GetAddress(), size_);
+            throw;
+        }
+
+        DestroyRelocated(data_.GetAddress(), size_);
+        data_.Swap(newData);
+        size_ += count;
+    }
+
+    void Append(const T* data, size_t n) {
+        AppendRange(data, data + n);
+    }
+
+    constexpr void PopBack() noexcept {
+        if (size_ == 0) return;
+
+        std::destroy_at(data_.GetAddress() + size_ - 1);
+        --size_;
+    }
+
+    template <typename... Args>
+    constexpr T& EmplaceBack(Args&&... args) {
+        T* ptr = nullptr;
+
+        if constexpr (Share::kEnabled) {
+            if (size_ == Capacity() && HasLiveSnapshot()) {
+                Reserve(GrowCapacity(size_ + 1));
+            }
+        }
+
+        if (size_ < Capacity()) {
+            ptr = std::construct_at(data_.GetAddress() + size_, std::forward<Args>(args)...);
+            ++size_;
+            return *ptr;
+        }
+
+        RawMemory<T, Alloc> newData(GrowCapacity(size_ + 1), data_.GetAllocator());
+        NoteReallocation(size_, newData.Capacity());
+
+        Relocate(data_.GetAddress(), size_, newData.GetAddress());
+
+        if constexpr (kNoThrowConstruction<Args&&...>) {
+            ptr = std::construct_at(newData.GetAddress() + size_, std::forward<Args>(args)...);
+        } else {
+            try {
+                ptr = std::construct_at(newData.GetAddress() + size_, std::forward<Args>(args)...);
             } catch (...) {
-                std::destroy_at(new_item_ptr);
-                std::destroy_n(new_data.GetAddress(), index);
+                DestroyRelocated(newData.GetAddress(), size_);
                 throw;
             }
+        }
+
+        DestroyRelocated(data_.GetAddress(), size_);
+        data_.Swap(newData);
+        ++size_;
+        return *ptr;
+    }
+
+    template <typename... Args>
+    iterator Emplace(const_iterator pos, Args&&... args) {
+        if (pos < begin() || pos > end()) {
+            throw std::out_of_range("Invalid position");
+        }
+
+        size_t index = pos - begin();
+
+        if constexpr (Share::kEnabled) {
+            if (size_ == Capacity() && HasLiveSnapshot()) {
+                Reserve(GrowCapacity(size_ + 1));
+            }
+        }
+
+        if (size_ == Capacity()) {
+            RawMemory<T, Alloc> new_data(GrowCapacity(size_ + 1), data_.GetAllocator());
+            NoteReallocation(size_, new_data.Capacity());
+
+            Relocate(data_.GetAddress(), index, new_data.GetAddress());
+
+            T* new_item_ptr = nullptr;
+            if constexpr (kNoThrowConstruction<Args&&...>) {
+                new_item_ptr = std::construct_at(new_data.GetAddress() + index, std::forward<Args>(args)...);
+            } else {
+                try {
+                    new_item_ptr = std::construct_at(new_data.GetAddress() + index, std::forward<Args>(args)...);
+                } catch (...) {
+                    DestroyRelocated(new_data.GetAddress(), index);
+                    throw;
+                }
+            }
+
+            if constexpr (kNoThrowRelocation) {
+                Relocate(data_.GetAddress() + index, size_ - index, new_data.GetAddress() + index + 1);
+            } else {
+                try {
+                    Relocate(data_.GetAddress() + index, size_ - index, new_data.GetAddress() + index + 1);
+                } catch (...) {
+                    std::destroy_at(new_item_ptr);
+                    DestroyRelocated(new_data.GetAddress(), index);
+                    throw;
+                }
+            }
 
-            std::destroy_n(data_.GetAddress(), size_);
+            DestroyRelocated(data_.GetAddress(), size_);
             data_.Swap(new_data);
             ++size_;
             return begin() + index;
 
         } else {
             if (index == size_) {
-                new (data_.GetAddress() + size_) T(std::forward<Args>(args)...);
+                std::construct_at(data_.GetAddress() + size_, std::forward<Args>(args)...);
+            } else if constexpr (ExcPolicy::kAssumeNoThrow) {
+                // Без защитной копии: конструируем прямо в освобождённый слот
+                std::construct_at(data_.GetAddress() + size_, std::move(data_[size_ - 1]));
+                std::move_backward(
+                    data_.GetAddress() + index,
+                    data_.GetAddress() + size_ - 1,
+                    data_.GetAddress() + size_
+                );
+                std::destroy_at(data_.GetAddress() + index);
+                std::construct_at(data_.GetAddress() + index, std::forward<Args>(args)...);
             } else {
                 T temp(std::forward<Args>(args)...);
 
-                new (data_.GetAddress() + size_) T(std::move(data_[size_ - 1]));
+                std::construct_at(data_.GetAddress() + size_, std::move(data_[size_ - 1]));
 
                 try {
                     std::move_backward(
@@ -347,8 +1162,41 @@ public:
 
         size_t index = pos - cbegin();
 
-        for (size_t i = index; i + 1 < size_; ++i) {
-            data_[i] = std::move(data_[i + 1]);
+        std::move(begin() + index + 1, end(), begin() + index);
+
+        std::destroy_at(data_.GetAddress() + size_ - 1);
+        --size_;
+
+        return begin() + index;
+    }
+
+    iterator Erase(const_iterator first, const_iterator last) {
+        if (first < cbegin() || last > cend() || first > last) {
+            throw std::out_of_range("Invalid range");
+        }
+
+        size_t index = first - cbegin();
+        size_t count = last - first;
+        if (count == 0) return begin() + index;
+
+        std::move(begin() + index + count, end(), begin() + index);
+
+        std::destroy_n(data_.GetAddress() + size_ - count, count);
+        size_ -= count;
+
+        return begin() + index;
+    }
+
+    // O(1) удаление без сохранения порядка: последний элемент встаёт на место pos
+    iterator EraseSwapLast(const_iterator pos) {
+        if (pos < cbegin() || pos >= cend()) {
+            throw std::out_of_range("Invalid position");
+        }
+
+        size_t index = pos - cbegin();
+
+        if (index + 1 != size_) {
+            data_[index] = std::move(data_[size_ - 1]);
         }
 
         std::destroy_at(data_.GetAddress() + size_ - 1);
@@ -361,15 +1209,466 @@ public:
         return Emplace(pos, value);
     }
 
+    template <typename It>
+    iterator Insert(const_iterator pos, It first, It last) {
+        if (pos < cbegin() || pos > cend()) {
+            throw std::out_of_range("Invalid position");
+        }
+
+        size_t index = pos - cbegin();
+
+        // Input-итератор — однопроходный: сначала буферизуем источник
+        if constexpr (!IsForwardIterator<It>) {
+            Vector temp(first, last, data_.GetAllocator());
+            return Insert(begin() + index, temp.begin(), temp.end());
+        }
+
+        size_t count = static_cast<size_t>(std::distance(first, last));
+        if (count == 0) return begin() + index;
+
+        if constexpr (Share::kEnabled) {
+            if (size_ + count > Capacity() && HasLiveSnapshot()) {
+                Reserve(GrowCapacity(size_ + count));
+            }
+        }
+
+        if (size_ + count > Capacity()) {
+            RawMemory<T, Alloc> new_data(GrowCapacity(size_ + count), data_.GetAllocator());
+            NoteReallocation(size_, new_data.Capacity());
+
+            Relocate(data_.GetAddress(), index, new_data.GetAddress());
+
+            try {
+                std::uninitialized_copy(first, last, new_data.GetAddress() + index);
+            } catch (...) {
+                DestroyRelocated(new_data.GetAddress(), index);
+                throw;
+            }
+
+            try {
+                Relocate(data_.GetAddress() + index, size_ - index, new_data.GetAddress() + index + count);
+            } catch (...) {
+                DestroyRelocated(new_data.GetAddress(), index);
+                std::destroy_n(new_data.GetAddress() + index, count);
+                throw;
+            }
+
+            DestroyRelocated(data_.GetAddress(), size_);
+            data_.Swap(new_data);
+            size_ += count;
+            return begin() + index;
+        }
+
+        size_t tail = size_ - index;
+
+        if (count >= tail) {
+            // Хвост целиком переезжает в сырую область за концом окна
+            std::uninitialized_move_n(data_.GetAddress() + index, tail, data_.GetAddress() + index + count);
+            try {
+                It mid = std::next(first, static_cast<ptrdiff_t>(tail));
+                std::copy(first, mid, data_.GetAddress() + index);
+                std::uninitialized_copy(mid, last, data_.GetAddress() + index + tail);
+            } catch (...) {
+                std::destroy_n(data_.GetAddress() + index + count, tail);
+                throw;
+            }
+        } else {
+            // Окно шириной count открывается одним сдвигом хвоста
+            std::uninitialized_move_n(data_.GetAddress() + size_ - count, count, data_.GetAddress() + size_);
+            try {
+                std::move_backward(begin() + index, begin() + size_ - count, begin() + size_);
+                std::copy(first, last, data_.GetAddress() + index);
+            } catch (...) {
+                std::destroy_n(data_.GetAddress() + size_, count);
+                throw;
+            }
+        }
+
+        size_ += count;
+        return begin() + index;
+    }
+
     iterator Insert(const_iterator pos, T&& value) {
         return Emplace(pos, std::move(value));
     }
 
-    const T& operator[](size_t index) const noexcept {
+    void Fill(const T& value) {
+        if constexpr (std::is_integral_v<T> && sizeof(T) == 1) {
+            std::memset(data_.GetAddress(), static_cast<int>(value), size_);
+        } else {
+            std::fill(begin(), end(), value);
+        }
+    }
+
+    iterator Find(const T& value) noexcept {
+        return const_cast<iterator>(SimdFindN(data_.GetAddress(), size_, value));
+    }
+
+    const_iterator Find(const T& value) const noexcept {
+        return SimdFindN(data_.GetAddress(), size_, value);
+    }
+
+    // Поисковые члены для векторов, поддерживаемых отсортированными
+    iterator LowerBound(const T& value) noexcept {
+        return const_cast<iterator>(std::as_const(*this).LowerBound(value));
+    }
+
+    const_iterator LowerBound(const T& value) const noexcept {
+        return BranchlessLowerBound(data_.GetAddress(), size_, value,
+                                    [](const T& lhs, const T& rhs) { return lhs < rhs; });
+    }
+
+    iterator UpperBound(const T& value) noexcept {
+        return const_cast<iterator>(std::as_const(*this).UpperBound(value));
+    }
+
+    const_iterator UpperBound(const T& value) const noexcept {
+        return BranchlessLowerBound(data_.GetAddress(), size_, value,
+                                    [](const T& lhs, const T& rhs) { return !(rhs < lhs); });
+    }
+
+    bool Contains(const T& value) const noexcept {
+        const_iterator it = LowerBound(value);
+        return it != cend() && !(value < *it);
+    }
+
+    bool Equal(const Vector& other) const noexcept {
+        if (size_ != other.size_) {
+            return false;
+        }
+        if constexpr (std::has_unique_object_representations_v<T>) {
+            return size_ == 0
+                || std::memcmp(data_.GetAddress(), other.data_.GetAddress(), size_ * sizeof(T)) == 0;
+        } else {
+            return std::equal(begin(), end(), other.begin());
+        }
+    }
+
+    // Сортировка чанков рабочими потоками с последующим параллельным слиянием
+    // пар соседних блоков по дереву (std::inplace_merge поверх непрерывного
+    // буфера); ниже порога — обычный std::sort
+    template <typename Compare = std::less<T>>
+    void ParallelSort(Compare comp = Compare{}) {
+        const size_t workers = ParallelWorkers(size_);
+        if (workers <= 1) {
+            std::sort(begin(), end(), comp);
+            return;
+        }
+
+        const size_t chunk = (size_ + workers - 1) / workers;
+        RunParallel(size_, workers, [&](size_t, size_t from, size_t to) {
+            std::sort(begin() + from, begin() + to, comp);
+        });
+
+        for (size_t width = chunk; width < size_; width *= 2) {
+            const size_t pair_count = (size_ - width + 2 * width - 1) / (2 * width);
+            RunParallel(pair_count, std::min(workers, pair_count),
+                        [&](size_t, size_t from_pair, size_t to_pair) {
+                for (size_t p = from_pair; p < to_pair; ++p) {
+                    T* base = begin() + p * 2 * width;
+                    T* mid = base + width;
+                    T* last = begin() + std::min((p * 2 + 2) * width, size_);
+                    std::inplace_merge(base, mid, last, comp);
+                }
+            });
+        }
+    }
+
+    // Поразрядная LSD-сортировка для целочисленных T; знаковые ключи
+    // переводятся в монотонный беззнаковый образ инверсией знакового бита
+    void RadixSort() {
+        static_assert(std::is_integral_v<T>, "RadixSort requires an integral T");
+        RadixSortByKey([](const T& value) { return value; });
+    }
+
+    // LSD по байтам ключа со стабильным рассеиванием в ping-pong буфер;
+    // однородные байтовые разряды (обычно старшие) пропускаются без прохода.
+    // Тип ограничен тривиально копируемыми записями: рассеивание работает
+    // прямым присваиванием в сырой буфер
+    template <typename KeyFn>
+    void RadixSortByKey(KeyFn key) {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "RadixSortByKey requires trivially copyable T");
+        using Key = std::decay_t<decltype(key(std::declval<const T&>()))>;
+        static_assert(std::is_integral_v<Key>, "Key must be integral");
+        using UKey = std::make_unsigned_t<Key>;
+
+        if (size_ < 2) return;
+
+        auto image = [&key](const T& value) {
+            UKey u = static_cast<UKey>(key(value));
+            if constexpr (std::is_signed_v<Key>) {
+                u ^= UKey(1) << (sizeof(Key) * 8 - 1);
+            }
+            return u;
+        };
+
+        RawMemory<T, Alloc> scratch(size_, data_.GetAllocator());
+        T* from = data_.GetAddress();
+        T* to = scratch.GetAddress();
+
+        for (size_t pass = 0; pass < sizeof(Key); ++pass) {
+            const unsigned shift = static_cast<unsigned>(pass * 8);
+            size_t count[256] = {};
+            for (size_t i = 0; i < size_; ++i) {
+                ++count[(image(from[i]) >> shift) & 0xFF];
+            }
+
+            bool uniform = false;
+            for (size_t b = 0; b < 256; ++b) {
+                if (count[b] == size_) {
+                    uniform = true;
+                    break;
+                }
+            }
+            if (uniform) continue;
+
+            size_t position[256];
+            size_t total = 0;
+            for (size_t b = 0; b < 256; ++b) {
+                position[b] = total;
+                total += count[b];
+            }
+
+            for (size_t i = 0; i < size_; ++i) {
+                to[position[(image(from[i]) >> shift) & 0xFF]++] = from[i];
+            }
+            std::swap(from, to);
+        }
+
+        if (from != data_.GetAddress()) {
+            std::memcpy(data_.GetAddress(), from, size_ * sizeof(T));
+        }
+    }
+
+    // fn вызывается из нескольких потоков для непересекающихся элементов
+    template <typename Fn>
+    void ParallelForEach(Fn fn) {
+        const size_t workers = ParallelWorkers(size_);
+        if (workers <= 1) {
+            std::for_each(begin(), end(), fn);
+            return;
+        }
+
+        RunParallel(size_, workers, [&](size_t, size_t from, size_t to) {
+            std::for_each(begin() + from, begin() + to, fn);
+        });
+    }
+
+    // op должен быть ассоциативным, а init — нейтральным элементом: каждый
+    // воркер сворачивает свой диапазон от init, частичные результаты
+    // складываются тем же op в порядке диапазонов
+    template <typename U, typename BinaryOp>
+    U ParallelReduce(U init, BinaryOp op) const {
+        const size_t workers = ParallelWorkers(size_);
+        if (workers <= 1) {
+            return std::accumulate(begin(), end(), std::move(init), op);
+        }
+
+        auto partials = std::make_unique<U[]>(workers);
+        const size_t used = RunParallel(size_, workers, [&](size_t index, size_t from, size_t to) {
+            partials[index] = std::accumulate(begin() + from, begin() + to, init, op);
+        });
+
+        U result = std::move(init);
+        for (size_t i = 0; i < used; ++i) {
+            result = op(std::move(result), std::move(partials[i]));
+        }
+        return result;
+    }
+
+    template <typename It>
+    void Assign(It first, It last) {
+        // Input-итератор — однопроходный: перезаписываем имеющиеся элементы,
+        // остаток источника дописываем через PushBack
+        if constexpr (!IsForwardIterator<It>) {
+            size_t kept = 0;
+            for (; first != last && kept < size_; ++first, ++kept) {
+                data_[kept] = *first;
+            }
+            if (first == last) {
+                std::destroy_n(data_.GetAddress() + kept, size_ - kept);
+                size_ = kept;
+                return;
+            }
+            for (; first != last; ++first) {
+                PushBack(*first);
+            }
+            return;
+        }
+
+        const size_t count = static_cast<size_t>(std::distance(first, last));
+
+        if (count > Capacity()) {
+            RawMemory<T, Alloc> newData(count, data_.GetAllocator());
+            NoteReallocation(size_t(0), newData.Capacity());
+            std::uninitialized_copy(first, last, newData.GetAddress());
+            if constexpr (Share::kEnabled) {
+                if (HasLiveSnapshot()) {
+                    DetachBufferToSnapshot();
+                    data_.Swap(newData);
+                    size_ = count;
+                    return;
+                }
+            }
+            Exec::DestroyN(data_.GetAddress(), size_);
+            data_.Swap(newData);
+            size_ = count;
+            return;
+        }
+
+        // Только указатель ровно на T: для конвертируемых типов (int* -> long)
+        // байтовое копирование читало бы источник не тем шагом
+        if constexpr (std::is_trivially_copyable_v<T> && std::is_pointer_v<It>
+                      && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<It>>, T>) {
+            if (count != 0) {
+                std::memcpy(data_.GetAddress(), first, count * sizeof(T));
+            }
+            size_ = count;
+            return;
+        }
+
+        const size_t common = std::min(size_, count);
+        It mid = std::next(first, static_cast<ptrdiff_t>(common));
+        std::copy(first, mid, data_.GetAddress());
+        if (count > size_) {
+            std::uninitialized_copy(mid, last, data_.GetAddress() + size_);
+        } else {
+            std::destroy_n(data_.GetAddress() + count, size_ - count);
+        }
+        size_ = count;
+    }
+
+    // Снимок на проводе: заголовок + сырые байты data_ (см. WireHeader).
+    // Только для тривиально копируемых T
+    size_t SerializedSize() const noexcept {
+        return sizeof(WireHeader) + size_ * sizeof(T);
+    }
+
+    // Возвращает число записанных байтов
+    size_t WriteTo(void* buffer, size_t capacity) const {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "Serialization requires trivially copyable T");
+        if (capacity < SerializedSize()) {
+            throw std::runtime_error("Vector: serialization buffer too small");
+        }
+
+        const WireHeader header{kWireMagic, sizeof(T), size_};
+        char* out = static_cast<char*>(buffer);
+        std::memcpy(out, &header, sizeof header);
+        std::memcpy(out + sizeof header, data_.GetAddress(), size_ * sizeof(T));
+        return SerializedSize();
+    }
+
+    // Возвращает число прочитанных байтов
+    size_t ReadFrom(const void* buffer, size_t size) {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "Serialization requires trivially copyable T");
+        WireHeader header;
+        if (size < sizeof header) {
+            throw std::runtime_error("Vector: truncated serialized data");
+        }
+        std::memcpy(&header, buffer, sizeof header);
+        CheckWireHeader(header);
+        // Сравнение делением: sizeof header + header.size * sizeof(T) могло бы
+        // переполниться на враждебном заголовке и пройти проверку
+        if (header.size > (size - sizeof header) / sizeof(T)) {
+            throw std::runtime_error("Vector: truncated serialized data");
+        }
+
+        // Данные начинаются на 24-м байте, так что каст к const T* был бы
+        // невыровнен при alignof(T) > 8 — копируем байтами, T тривиален
+        const char* payload = static_cast<const char*>(buffer) + sizeof header;
+        const size_t count = header.size;
+
+        if (count > Capacity()) {
+            RawMemory<T, Alloc> newData(count, data_.GetAllocator());
+            NoteReallocation(size_t(0), newData.Capacity());
+            std::memcpy(newData.GetAddress(), payload, count * sizeof(T));
+            if constexpr (Share::kEnabled) {
+                if (HasLiveSnapshot()) {
+                    DetachBufferToSnapshot();
+                    data_.Swap(newData);
+                    size_ = count;
+                    return sizeof(WireHeader) + count * sizeof(T);
+                }
+            }
+            Exec::DestroyN(data_.GetAddress(), size_);
+            data_.Swap(newData);
+            size_ = count;
+            return sizeof(WireHeader) + count * sizeof(T);
+        }
+
+        if (count != 0) {
+            std::memcpy(data_.GetAddress(), payload, count * sizeof(T));
+        }
+        size_ = count;  // деструкторы тривиальны — лишний хвост просто забывается
+        return sizeof(WireHeader) + count * sizeof(T);
+    }
+
+#if defined(__linux__)
+    // Заголовок и содержимое уходят одним writev; редкий частичный результат
+    // дописывается обычными write
+    void WriteTo(int fd) const {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "Serialization requires trivially copyable T");
+        const WireHeader header{kWireMagic, sizeof(T), size_};
+        const char* body = reinterpret_cast<const char*>(data_.GetAddress());
+        const size_t body_bytes = size_ * sizeof(T);
+
+        iovec iov[2] = {{const_cast<WireHeader*>(&header), sizeof header},
+                        {const_cast<char*>(body), body_bytes}};
+        const ssize_t done = ::writev(fd, iov, 2);
+        if (done < 0) {
+            throw std::runtime_error("Vector: serialization write failed");
+        }
+
+        size_t written = static_cast<size_t>(done);
+        if (written < sizeof header) {
+            WriteFully(fd, reinterpret_cast<const char*>(&header) + written, sizeof header - written);
+            written = sizeof header;
+        }
+        WriteFully(fd, body + (written - sizeof header), body_bytes - (written - sizeof header));
+    }
+
+    // Одна аллокация через RawMemory и чтение прямо в буфер, минуя
+    // инициализацию (парно к ResizeUninitialized)
+    void ReadFrom(int fd) {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "Serialization requires trivially copyable T");
+        WireHeader header;
+        ReadFully(fd, reinterpret_cast<char*>(&header), sizeof header);
+        CheckWireHeader(header);
+        const size_t count = header.size;
+
+        if (count > Capacity()) {
+            RawMemory<T, Alloc> newData(count, data_.GetAllocator());
+            NoteReallocation(size_t(0), newData.Capacity());
+            ReadFully(fd, reinterpret_cast<char*>(newData.GetAddress()), count * sizeof(T));
+            if constexpr (Share::kEnabled) {
+                if (HasLiveSnapshot()) {
+                    DetachBufferToSnapshot();
+                    data_.Swap(newData);
+                    size_ = count;
+                    return;
+                }
+            }
+            Exec::DestroyN(data_.GetAddress(), size_);
+            data_.Swap(newData);
+            size_ = count;
+            return;
+        }
+
+        ReadFully(fd, reinterpret_cast<char*>(data_.GetAddress()), count * sizeof(T));
+        size_ = count;  // деструкторы тривиальны — лишний хвост просто забывается
+    }
+#endif
+
+    constexpr const T& operator[](size_t index) const noexcept {
         return const_cast<Vector&>(*this)[index];
     }
 
-    T& operator[](size_t index) noexcept {
+    constexpr T& operator[](size_t index) noexcept {
         assert(index < size_);
         return data_[index];
     }
@@ -378,17 +1677,180 @@ public:
         std::destroy_n(ptr, size);
     }
 
-    ~Vector() {
-        std::destroy_n(data_.GetAddress(), size_);
+    constexpr ~Vector() {
+        if constexpr (Share::kEnabled) {
+            if (share_.block != nullptr) {
+                if (HasLiveSnapshot()) {
+                    DetachBufferToSnapshot();
+                    return;
+                }
+                ReleaseSnapshotBlock(share_.block);
+                share_.block = nullptr;
+            }
+        }
+        Exec::DestroyN(data_.GetAddress(), size_);
     }
 
 private:
-    void AssignFromSmaller(const Vector& rhs) {
+    template <typename... Args>
+    static constexpr bool kNoThrowConstruction =
+        ExcPolicy::kAssumeNoThrow || std::is_nothrow_constructible_v<T, Args...>;
+
+    static constexpr bool kNoThrowRelocation =
+        ExcPolicy::kAssumeNoThrow || TriviallyRelocatable<T>::value
+        || std::is_nothrow_move_constructible_v<T>;
+
+    struct SnapshotBlock {
+        RawMemory<T, Alloc> storage;
+        size_t constructed = 0;
+        std::atomic<size_t> refs{1};  // одна ссылка принадлежит писателю
+    };
+
+    struct SnapshotStateDisabled {};
+
+    struct SnapshotStateEnabled {
+        SnapshotBlock* block = nullptr;
+    };
+
+    static void ReleaseSnapshotBlock(SnapshotBlock* block) noexcept {
+        if (block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::destroy_n(block->storage.GetAddress(), block->constructed);
+            delete block;
+        }
+    }
+
+    bool HasLiveSnapshot() const noexcept {
+        return share_.block != nullptr && share_.block->refs.load(std::memory_order_acquire) > 1;
+    }
+
+    // Передаёт текущий буфер вместе с живыми элементами снимкам; data_ пустеет
+    void DetachBufferToSnapshot() noexcept {
+        share_.block->storage = std::move(data_);
+        share_.block->constructed = size_;
+        ReleaseSnapshotBlock(share_.block);
+        share_.block = nullptr;
+    }
+
+    struct WireHeader {
+        uint64_t magic;
+        uint64_t element_size;
+        uint64_t size;
+    };
+
+    static constexpr uint64_t kWireMagic = 0x4156575249544531ull;  // "AVWRITE1"
+
+    static void CheckWireHeader(const WireHeader& header) {
+        if (header.magic != kWireMagic || header.element_size != sizeof(T)) {
+            throw std::runtime_error("Vector: wire format mismatch");
+        }
+        // Защита от аллокации по враждебному заголовку: count * sizeof(T) не
+        // должно переполнять size_t
+        if (header.size > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            throw std::runtime_error("Vector: wire format mismatch");
+        }
+    }
+
+#if defined(__linux__)
+    static void WriteFully(int fd, const char* data, size_t count) {
+        while (count != 0) {
+            const ssize_t done = ::write(fd, data, count);
+            if (done <= 0) {
+                throw std::runtime_error("Vector: serialization write failed");
+            }
+            data += done;
+            count -= static_cast<size_t>(done);
+        }
+    }
+
+    static void ReadFully(int fd, char* data, size_t count) {
+        while (count != 0) {
+            const ssize_t done = ::read(fd, data, count);
+            if (done <= 0) {
+                throw std::runtime_error("Vector: serialization read failed");
+            }
+            data += done;
+            count -= static_cast<size_t>(done);
+        }
+    }
+#endif
+
+    static constexpr size_t kParallelThreshold = size_t(1) << 16;
+    static constexpr size_t kMinParallelChunk = kParallelThreshold / 4;
+
+    static size_t ParallelWorkers(size_t count) noexcept {
+        const size_t hw = std::thread::hardware_concurrency();
+        if (count < kParallelThreshold || hw <= 1) {
+            return 1;
+        }
+        return std::min(hw, count / kMinParallelChunk);
+    }
+
+    // Запускает work(index, from, to) на workers потоках по диапазонам count;
+    // первое пойманное исключение перебрасывается после join всех потоков.
+    // Возвращает число реально запущенных потоков
+    template <typename Work>
+    static size_t RunParallel(size_t count, size_t workers, Work work) {
+        const size_t chunk = (count + workers - 1) / workers;
+        auto threads = std::make_unique<std::thread[]>(workers);
+        std::mutex error_mutex;
+        std::exception_ptr error;
+
+        size_t spawned = 0;
+        for (size_t i = 0; i < workers; ++i) {
+            const size_t from = i * chunk;
+            const size_t to = std::min(from + chunk, count);
+            if (from >= to) break;
+
+            threads[spawned++] = std::thread([&, i, from, to] {
+                try {
+                    work(i, from, to);
+                } catch (...) {
+                    std::lock_guard lock(error_mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+            });
+        }
+        for (size_t i = 0; i < spawned; ++i) {
+            threads[i].join();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return spawned;
+    }
+
+    constexpr size_t GrowCapacity(size_t needed) const {
+        return Growth::Grow(Capacity(), needed);
+    }
+
+    constexpr void NoteReallocation(size_t elements_moved, size_t new_capacity) noexcept {
+        stats_.OnReallocation(elements_moved, sizeof(T));
+        stats_.OnCapacity(new_capacity);
+    }
+
+    static constexpr void Relocate(T* from, size_t count, T* to) {
+        Exec::RelocateRange(from, count, to);
+    }
+
+    static constexpr void DestroyRelocated([[maybe_unused]] T* from, [[maybe_unused]] size_t count) noexcept {
+        if (std::is_constant_evaluated()) {
+            // Перенос в константных вычислениях всегда поэлементный — источник жив
+            Exec::DestroyN(from, count);
+            return;
+        }
+        if constexpr (!TriviallyRelocatable<T>::value) {
+            Exec::DestroyN(from, count);
+        }
+    }
+
+    constexpr void AssignFromSmaller(const Vector& rhs) {
         size_t common = std::min(size_, rhs.size_);
         std::copy_n(rhs.data_.GetAddress(), common, data_.GetAddress());
 
         if (rhs.size_ > size_) {
-            std::uninitialized_copy_n(
+            CopyConstructN(
                 rhs.data_.GetAddress() + common,
                 rhs.size_ - common,
                 data_.GetAddress() + common
@@ -400,6 +1862,9 @@ private:
     }
 
 private:
-    RawMemory<T> data_;
+    RawMemory<T, Alloc> data_;
     size_t size_ = 0;
+    [[no_unique_address]] StatsPolicy stats_{};
+    [[no_unique_address]] std::conditional_t<Share::kEnabled, SnapshotStateEnabled,
+                                             SnapshotStateDisabled> share_{};
 };
\ No newline at end of file
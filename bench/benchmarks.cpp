@@ -0,0 +1,158 @@
+#include "../advanced-vector/vector.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Замеры горячих операций Vector против std::vector как базовой линии.
+// Сборка: g++ -std=c++20 -O2 bench/benchmarks.cpp -o bench_vector
+// Запуск: ./bench_vector [N] (по умолчанию N = 1'000'000; для стабильных
+// цифр прижимайте процесс к ядру: taskset -c 0 ./bench_vector)
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+volatile uint64_t sink = 0;
+
+template <typename Fn>
+double MeasureMs(Fn&& fn) {
+    const auto start = Clock::now();
+    fn();
+    const auto finish = Clock::now();
+    return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+void Report(const char* name, size_t n, double ours_ms, double std_ms) {
+    std::cout << name << " (N=" << n << "): Vector " << ours_ms << " ms, std::vector " << std_ms
+              << " ms, ratio " << (std_ms > 0 ? ours_ms / std_ms : 0.0) << '\n';
+}
+
+void BenchPushBackTrivial(size_t n) {
+    const double ours = MeasureMs([n] {
+        Vector<uint64_t> v;
+        for (size_t i = 0; i < n; ++i) {
+            v.PushBack(i);
+        }
+        sink = sink + v[n - 1];
+    });
+    const double base = MeasureMs([n] {
+        std::vector<uint64_t> v;
+        for (size_t i = 0; i < n; ++i) {
+            v.push_back(i);
+        }
+        sink = sink + v[n - 1];
+    });
+    Report("PushBack<uint64_t> growth", n, ours, base);
+}
+
+void BenchPushBackNonTrivial(size_t n) {
+    const std::string value = "benchmark-string-long-enough-to-heap-allocate";
+    const double ours = MeasureMs([n, &value] {
+        Vector<std::string> v;
+        for (size_t i = 0; i < n; ++i) {
+            v.PushBack(value);
+        }
+        sink = sink + v[n - 1].size();
+    });
+    const double base = MeasureMs([n, &value] {
+        std::vector<std::string> v;
+        for (size_t i = 0; i < n; ++i) {
+            v.push_back(value);
+        }
+        sink = sink + v[n - 1].size();
+    });
+    Report("PushBack<std::string> growth", n, ours, base);
+}
+
+void BenchReserveRelocation(size_t n) {
+    const double ours = MeasureMs([n] {
+        Vector<uint64_t> v(n);
+        v.Reserve(n * 2);
+        sink = sink + v[0];
+    });
+    const double base = MeasureMs([n] {
+        std::vector<uint64_t> v(n);
+        v.reserve(n * 2);
+        sink = sink + v[0];
+    });
+    Report("Reserve relocation", n, ours, base);
+}
+
+void BenchEmplaceMiddle(size_t n) {
+    const size_t inserts = std::min<size_t>(n, 20'000);
+    const double ours = MeasureMs([inserts] {
+        Vector<uint64_t> v;
+        for (size_t i = 0; i < inserts; ++i) {
+            v.Emplace(v.cbegin() + v.Size() / 2, i);
+        }
+        sink = sink + v[0];
+    });
+    const double base = MeasureMs([inserts] {
+        std::vector<uint64_t> v;
+        for (size_t i = 0; i < inserts; ++i) {
+            v.emplace(v.cbegin() + v.size() / 2, i);
+        }
+        sink = sink + v[0];
+    });
+    Report("Emplace middle", inserts, ours, base);
+}
+
+void BenchErase(size_t n) {
+    const size_t erases = std::min<size_t>(n, 20'000);
+    const double ours = MeasureMs([erases] {
+        Vector<uint64_t> v(erases * 2);
+        for (size_t i = 0; i < erases; ++i) {
+            v.Erase(v.cbegin() + v.Size() / 2);
+        }
+        sink = sink + v.Size();
+    });
+    const double base = MeasureMs([erases] {
+        std::vector<uint64_t> v(erases * 2);
+        for (size_t i = 0; i < erases; ++i) {
+            v.erase(v.cbegin() + v.size() / 2);
+        }
+        sink = sink + v.size();
+    });
+    Report("Erase middle", erases, ours, base);
+}
+
+void BenchCopyAssign(size_t n) {
+    const double ours = MeasureMs([n] {
+        Vector<uint64_t> src(n);
+        Vector<uint64_t> dst(n * 2);
+        // Путь AssignFromSmaller: ёмкости приёмника хватает
+        dst = src;
+        sink = sink + dst[0];
+    });
+    const double base = MeasureMs([n] {
+        std::vector<uint64_t> src(n);
+        std::vector<uint64_t> dst(n * 2);
+        dst = src;
+        sink = sink + dst[0];
+    });
+    Report("Copy assignment into larger capacity", n, ours, base);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    size_t n = 1'000'000;
+    if (argc > 1) {
+        n = static_cast<size_t>(std::strtoull(argv[1], nullptr, 10));
+    }
+    if (n == 0) {
+        std::cerr << "N must be positive" << std::endl;
+        return 1;
+    }
+
+    BenchPushBackTrivial(n);
+    BenchPushBackNonTrivial(n);
+    BenchReserveRelocation(n);
+    BenchEmplaceMiddle(n);
+    BenchErase(n);
+    BenchCopyAssign(n);
+}